@@ -234,6 +234,13 @@ class PageAllocator {
    */
   virtual bool SetPermissions(void* address, size_t length,
                               Permission permissions) = 0;
+
+  /**
+   * Hints that pages in a range allocated by a call to AllocatePages should be
+   * backed by huge pages where the operating system supports it. Returns true
+   * if the hint was applied.
+   */
+  virtual bool AdviseHugePages(void* address, size_t length) { return false; }
 };
 
 /**
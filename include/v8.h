@@ -6470,6 +6470,12 @@ class V8_EXPORT HeapStatistics {
   size_t number_of_native_contexts() { return number_of_native_contexts_; }
   size_t number_of_detached_contexts() { return number_of_detached_contexts_; }
 
+  /**
+   * Returns the number of bytes held by array buffer backing stores that are
+   * kept for reuse, see --array-buffer-pool.
+   */
+  size_t array_buffer_pool_size() { return array_buffer_pool_size_; }
+
   /**
    * Returns a 0/1 boolean, which signifies whether the V8 overwrite heap
    * garbage with a bit pattern.
@@ -6488,6 +6494,7 @@ class V8_EXPORT HeapStatistics {
   bool does_zap_garbage_;
   size_t number_of_native_contexts_;
   size_t number_of_detached_contexts_;
+  size_t array_buffer_pool_size_;
 
   friend class V8;
   friend class Isolate;
@@ -6544,6 +6551,63 @@ class V8_EXPORT HeapCodeStatistics {
   friend class Isolate;
 };
 
+/**
+ * Timings and sizes of a single garbage collection. All times are in
+ * milliseconds.
+ *
+ * Instances of this class can be passed to v8::Isolate::GetGCStatistics to
+ * get the statistics of one of the most recent garbage collections.
+ */
+class V8_EXPORT GCStatistics {
+ public:
+  GCStatistics();
+  GCType gc_type() { return gc_type_; }
+  /**
+   * Returns true if the collection was a mark-compact preceded by incremental
+   * or concurrent marking.
+   */
+  bool incremental() { return incremental_; }
+  double start_time() { return start_time_; }
+  /**
+   * Returns the wall time of the atomic pause on the main thread.
+   */
+  double pause_duration() { return pause_duration_; }
+  double mark_duration() { return mark_duration_; }
+  double evacuate_duration() { return evacuate_duration_; }
+  double sweep_duration() { return sweep_duration_; }
+  /**
+   * Returns the main thread time of incremental marking steps that preceded
+   * the atomic pause.
+   */
+  double incremental_duration() { return incremental_duration_; }
+  /**
+   * Returns the time spent by background tasks on behalf of this collection,
+   * summed over all tasks.
+   */
+  double background_duration() { return background_duration_; }
+  size_t object_size_before() { return object_size_before_; }
+  size_t object_size_after() { return object_size_after_; }
+  size_t promoted_bytes() { return promoted_bytes_; }
+  size_t survived_bytes() { return survived_bytes_; }
+
+ private:
+  GCType gc_type_;
+  bool incremental_;
+  double start_time_;
+  double pause_duration_;
+  double mark_duration_;
+  double evacuate_duration_;
+  double sweep_duration_;
+  double incremental_duration_;
+  double background_duration_;
+  size_t object_size_before_;
+  size_t object_size_after_;
+  size_t promoted_bytes_;
+  size_t survived_bytes_;
+
+  friend class Isolate;
+};
+
 class RetainedObjectInfo;
 
 
@@ -6695,6 +6759,14 @@ class V8_EXPORT PersistentHandleVisitor {  // NOLINT
  */
 enum class MemoryPressureLevel { kNone, kModerate, kCritical };
 
+/**
+ * Callback invoked when the size of live objects exceeds the soft heap limit
+ * set with Isolate::SetHeapSoftLimit. |heap_size| is the size of live objects
+ * after the garbage collection that detected the limit was exceeded.
+ */
+typedef void (*HeapSoftLimitCallback)(Isolate* isolate, size_t heap_size,
+                                      size_t soft_limit, void* data);
+
 /**
  * Interface for tracing through the embedder heap. During a v8 garbage
  * collection, v8 collects hidden fields of all potential wrappers, and at the
@@ -7231,6 +7303,22 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  /**
+   * Returns the number of recent garbage collections for which statistics are
+   * kept.
+   */
+  size_t NumberOfRecordedGCStatistics();
+
+  /**
+   * Get statistics about one of the most recent garbage collections.
+   *
+   * \param gc_statistics The GCStatistics object to fill in statistics.
+   * \param index The age of the collection, which ranges from 0 (the last
+   *   collection) to NumberOfRecordedGCStatistics() - 1.
+   * \returns true on success.
+   */
+  bool GetGCStatistics(GCStatistics* gc_statistics, size_t index);
+
   /**
    * Get a call stack sample from the isolate.
    * \param state Execution state.
@@ -7624,6 +7712,19 @@ class V8_EXPORT Isolate {
    */
   void SetRAILMode(RAILMode rail_mode);
 
+  /**
+   * Sets a soft limit for the size of live objects in the heap of this
+   * isolate. Once a full garbage collection finds more than |soft_limit| bytes
+   * of live objects, the callback is invoked asynchronously from a task posted
+   * to the isolate's foreground thread, and V8 switches to garbage collection
+   * heuristics that favor a small memory footprint until the heap shrinks
+   * below the limit again. The callback is invoked once per crossing. The hard
+   * limit is still given by the ResourceConstraints of the isolate. Passing a
+   * |soft_limit| of 0 removes the limit.
+   */
+  void SetHeapSoftLimit(size_t soft_limit, HeapSoftLimitCallback callback,
+                        void* data = nullptr);
+
   /**
    * Optional notification to tell V8 the current isolate is used for debugging
    * and requires higher heap limit.
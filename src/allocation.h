@@ -124,6 +124,15 @@ V8_EXPORT_PRIVATE
 V8_WARN_UNUSED_RESULT bool SetPermissions(void* address, size_t size,
                                           PageAllocator::Permission access);
 
+// Hints that the pages in the given range should be backed by huge pages.
+// |address| and |size| must be multiples of CommitPageSize(). Returns true if
+// the hint was applied.
+V8_EXPORT_PRIVATE bool AdviseHugePages(void* address, size_t size);
+
+// Size of the huge pages that AdviseHugePages() asks for. Regions that should
+// be eligible for huge pages are aligned to this size.
+const size_t kHugePageSize = 2 * MB;
+
 // Convenience function that allocates a single system page with read and write
 // permissions. |address| is a hint. Returns the base address of the memory and
 // the page size via |allocated| on success. Returns nullptr on failure.
@@ -43,6 +43,8 @@
 #include "src/gdb-jit.h"
 #include "src/global-handles.h"
 #include "src/globals.h"
+#include "src/heap/array-buffer-collector.h"
+#include "src/heap/gc-tracer.h"
 #include "src/icu_util.h"
 #include "src/isolate-inl.h"
 #include "src/json-parser.h"
@@ -5671,9 +5673,19 @@ class Utf8WriterVisitor {
       }
       // Write the characters to the stream.
       if (sizeof(Char) == 1) {
-        for (; i < fast_length; i++) {
+        while (i < fast_length) {
+          // ASCII characters encode to themselves, so copy runs of them in
+          // bulk and only encode the remaining characters one by one.
+          int ascii_length = i::String::NonAsciiStart(
+              reinterpret_cast<const char*>(chars), fast_length - i);
+          i::MemCopy(buffer, chars, ascii_length);
+          buffer += ascii_length;
+          chars += ascii_length;
+          i += ascii_length;
+          if (i == fast_length) break;
           buffer += unibrow::Utf8::EncodeOneByte(
               buffer, static_cast<uint8_t>(*chars++));
+          i++;
           DCHECK(capacity_ == -1 || (buffer - start_) <= capacity_);
         }
       } else {
@@ -6139,7 +6151,8 @@ HeapStatistics::HeapStatistics()
       peak_malloced_memory_(0),
       does_zap_garbage_(0),
       number_of_native_contexts_(0),
-      number_of_detached_contexts_(0) {}
+      number_of_detached_contexts_(0),
+      array_buffer_pool_size_(0) {}
 
 HeapSpaceStatistics::HeapSpaceStatistics(): space_name_(0),
                                             space_size_(0),
@@ -6157,6 +6170,21 @@ HeapObjectStatistics::HeapObjectStatistics()
 HeapCodeStatistics::HeapCodeStatistics()
     : code_and_metadata_size_(0), bytecode_and_metadata_size_(0) {}
 
+GCStatistics::GCStatistics()
+    : gc_type_(kGCTypeScavenge),
+      incremental_(false),
+      start_time_(0),
+      pause_duration_(0),
+      mark_duration_(0),
+      evacuate_duration_(0),
+      sweep_duration_(0),
+      incremental_duration_(0),
+      background_duration_(0),
+      object_size_before_(0),
+      object_size_after_(0),
+      promoted_bytes_(0),
+      survived_bytes_(0) {}
+
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
 }
@@ -8506,6 +8534,8 @@ void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
   heap_statistics->number_of_detached_contexts_ =
       heap->NumberOfDetachedContexts();
   heap_statistics->does_zap_garbage_ = heap->ShouldZapGarbage();
+  heap_statistics->array_buffer_pool_size_ =
+      heap->array_buffer_collector()->pool_size();
 }
 
 
@@ -8580,6 +8610,42 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
   return true;
 }
 
+size_t Isolate::NumberOfRecordedGCStatistics() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  return isolate->heap()->tracer()->RecordedSummaryCount();
+}
+
+bool Isolate::GetGCStatistics(GCStatistics* gc_statistics, size_t index) {
+  if (!gc_statistics) return false;
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::GCTracer* tracer = isolate->heap()->tracer();
+  if (index >= static_cast<size_t>(tracer->RecordedSummaryCount())) {
+    return false;
+  }
+
+  const i::GCTracer::Summary& summary =
+      tracer->RecordedSummary(static_cast<int>(index));
+  gc_statistics->gc_type_ =
+      summary.type == i::GCTracer::Event::SCAVENGER ||
+              summary.type == i::GCTracer::Event::MINOR_MARK_COMPACTOR
+          ? kGCTypeScavenge
+          : kGCTypeMarkSweepCompact;
+  gc_statistics->incremental_ =
+      summary.type == i::GCTracer::Event::INCREMENTAL_MARK_COMPACTOR;
+  gc_statistics->start_time_ = summary.start_time;
+  gc_statistics->pause_duration_ = summary.pause_duration;
+  gc_statistics->mark_duration_ = summary.mark_duration;
+  gc_statistics->evacuate_duration_ = summary.evacuate_duration;
+  gc_statistics->sweep_duration_ = summary.sweep_duration;
+  gc_statistics->incremental_duration_ = summary.incremental_duration;
+  gc_statistics->background_duration_ = summary.background_duration;
+  gc_statistics->object_size_before_ = summary.start_object_size;
+  gc_statistics->object_size_after_ = summary.end_object_size;
+  gc_statistics->promoted_bytes_ = summary.promoted_bytes;
+  gc_statistics->survived_bytes_ = summary.survived_bytes;
+  return true;
+}
+
 void Isolate::GetStackSample(const RegisterState& state, void** frames,
                              size_t frames_limit, SampleInfo* sample_info) {
   RegisterState regs = state;
@@ -8812,6 +8878,12 @@ void Isolate::SetRAILMode(RAILMode rail_mode) {
   return isolate->SetRAILMode(rail_mode);
 }
 
+void Isolate::SetHeapSoftLimit(size_t soft_limit,
+                               HeapSoftLimitCallback callback, void* data) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->SetHeapSoftLimit(soft_limit, callback, data);
+}
+
 void Isolate::IncreaseHeapLimitForDebugging() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   isolate->heap()->IncreaseHeapLimitForDebugging();
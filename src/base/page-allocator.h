@@ -34,6 +34,8 @@ class V8_BASE_EXPORT PageAllocator
 
   bool SetPermissions(void* address, size_t size,
                       PageAllocator::Permission access) override;
+
+  bool AdviseHugePages(void* address, size_t size) override;
 };
 
 }  // namespace base
@@ -169,6 +169,13 @@ bool OS::SetPermissions(void* address, size_t size, MemoryPermission access) {
   return VirtualAlloc(address, size, MEM_COMMIT, protect) != nullptr;
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) {
+  // Large pages on Windows require SeLockMemoryPrivilege, which V8 does not
+  // request.
+  return false;
+}
+
 // static
 bool OS::HasLazyCommits() {
   // TODO(alph): implement for the platform.
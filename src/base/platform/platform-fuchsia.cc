@@ -117,6 +117,9 @@ bool OS::SetPermissions(void* address, size_t size, MemoryPermission access) {
                          prot) == ZX_OK;
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 // static
 bool OS::HasLazyCommits() {
   // TODO(scottmg): Port, https://crbug.com/731217.
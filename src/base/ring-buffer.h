@@ -27,6 +27,15 @@ class RingBuffer {
 
   int Count() const { return count_; }
 
+  // Returns the |index|-th most recently pushed element, 0 being the newest.
+  const T& Get(int index) const {
+    DCHECK_LE(0, index);
+    DCHECK_LT(index, count_);
+    int j = start_ + count_ - 1 - index;
+    if (j >= kSize) j -= kSize;
+    return elements_[j];
+  }
+
   template <typename Callback>
   T Sum(Callback callback, const T& initial) const {
     int j = start_ + count_ - 1;
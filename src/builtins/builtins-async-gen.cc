@@ -24,26 +24,56 @@ void AsyncBuiltinsAssembler::Await(Node* context, Node* generator, Node* value,
   CSA_SLOW_ASSERT(this, IsBoolean(is_predicted_as_caught));
 
   Node* const native_context = LoadNativeContext(context);
-
-  // TODO(bmeurer): This could be optimized and folded into a single allocation.
-  Node* const promise = AllocateAndInitJSPromise(native_context);
-  Node* const promise_reactions =
-      LoadObjectField(promise, JSPromise::kReactionsOrResultOffset);
   Node* const fulfill_handler =
       HeapConstant(Builtins::CallableFor(isolate(), fulfill_builtin).code());
   Node* const reject_handler =
       HeapConstant(Builtins::CallableFor(isolate(), reject_builtin).code());
-  Node* const reaction = AllocatePromiseReaction(
-      promise_reactions, generator, fulfill_handler, reject_handler);
-  StoreObjectField(promise, JSPromise::kReactionsOrResultOffset, reaction);
-  PromiseSetHasHandler(promise);
 
-  // Perform ! Call(promiseCapability.[[Resolve]], undefined, « value »).
-  CallBuiltin(Builtins::kResolvePromise, native_context, promise, value);
+  // With --harmony-await-optimization, awaiting a native promise performs
+  // PromiseResolve(%Promise%, value), which is the {value} itself, and hooks
+  // the generator directly onto it. This skips the throwaway promise and the
+  // extra PromiseResolveThenableJob, so the await resumes one tick after
+  // {value} settles instead of three. We take the generic path whenever a
+  // PromiseHook is enabled or the debugger is active.
+  Label if_await_promise(this), if_wrap_value(this), done(this);
+  Node* const optimization_flag = Load(
+      MachineType::Uint8(),
+      ExternalConstant(
+          ExternalReference::address_of_harmony_await_optimization_flag(
+              isolate())));
+  GotoIf(Word32Equal(optimization_flag, Int32Constant(0)), &if_wrap_value);
+  GotoIf(TaggedIsSmi(value), &if_wrap_value);
+  Node* const value_map = LoadMap(value);
+  GotoIfNot(IsJSPromiseMap(value_map), &if_wrap_value);
+  GotoIf(IsPromiseHookEnabledOrDebugIsActive(), &if_wrap_value);
+  BranchIfPromiseSpeciesLookupChainIntact(native_context, value_map,
+                                          &if_await_promise, &if_wrap_value);
+
+  BIND(&if_await_promise);
+  {
+    PerformPromiseThen(native_context, value, fulfill_handler, reject_handler,
+                       generator);
+    Goto(&done);
+  }
+
+  BIND(&if_wrap_value);
+  {
+    // TODO(bmeurer): This could be optimized and folded into a single
+    // allocation.
+    Node* const promise = AllocateAndInitJSPromise(native_context);
+    Node* const promise_reactions =
+        LoadObjectField(promise, JSPromise::kReactionsOrResultOffset);
+    Node* const reaction = AllocatePromiseReaction(
+        promise_reactions, generator, fulfill_handler, reject_handler);
+    StoreObjectField(promise, JSPromise::kReactionsOrResultOffset, reaction);
+    PromiseSetHasHandler(promise);
+
+    // Perform ! Call(promiseCapability.[[Resolve]], undefined, « value »).
+    CallBuiltin(Builtins::kResolvePromise, native_context, promise, value);
+  }
 
   // When debugging, we need to link from the {generator} to the
   // {outer_promise} of the async function/generator.
-  Label done(this);
   GotoIfNot(IsDebugActive(), &done);
   CallRuntime(Runtime::kSetProperty, native_context, generator,
               LoadRoot(Heap::kgenerator_outer_promise_symbolRootIndex),
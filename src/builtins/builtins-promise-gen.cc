@@ -264,12 +264,22 @@ void PromiseBuiltinsAssembler::PerformPromiseThen(
     Node* result_promise_or_capability) {
   CSA_ASSERT(this, TaggedIsNotSmi(promise));
   CSA_ASSERT(this, IsJSPromise(promise));
-  CSA_ASSERT(this,
-             Word32Or(IsCallable(on_fulfilled), IsUndefined(on_fulfilled)));
-  CSA_ASSERT(this, Word32Or(IsCallable(on_rejected), IsUndefined(on_rejected)));
+  // Await passes a Code object for each handler, and the suspended generator
+  // in place of the result promise.
+  CSA_ASSERT(this, Word32Or(IsCallable(on_fulfilled),
+                            Word32Or(IsCode(on_fulfilled),
+                                     IsUndefined(on_fulfilled))));
+  CSA_ASSERT(this, Word32Or(IsCallable(on_rejected),
+                            Word32Or(IsCode(on_rejected),
+                                     IsUndefined(on_rejected))));
   CSA_ASSERT(this, TaggedIsNotSmi(result_promise_or_capability));
-  CSA_ASSERT(this, Word32Or(IsJSPromise(result_promise_or_capability),
-                            IsPromiseCapability(result_promise_or_capability)));
+  CSA_ASSERT(
+      this,
+      Word32Or(
+          Word32Or(IsJSPromise(result_promise_or_capability),
+                   IsPromiseCapability(result_promise_or_capability)),
+          Word32Or(IsJSGeneratorObject(result_promise_or_capability),
+                   IsJSAsyncGeneratorObject(result_promise_or_capability))));
 
   Label if_pending(this), if_notpending(this), done(this);
   Node* const status = PromiseStatus(promise);
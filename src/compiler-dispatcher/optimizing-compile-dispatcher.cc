@@ -4,6 +4,8 @@
 
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
+#include <algorithm>
+
 #include "src/base/atomicops.h"
 #include "src/cancelable-task.h"
 #include "src/compilation-info.h"
@@ -89,15 +91,47 @@ OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
 #endif
   DCHECK_EQ(0, input_queue_length_);
   DeleteArray(input_queue_);
+  DeleteArray(input_queue_priorities_);
 }
 
-CompilationJob* OptimizingCompileDispatcher::NextInput(bool check_if_flushing) {
-  base::LockGuard<base::Mutex> access_input_queue_(&input_queue_mutex_);
-  if (input_queue_length_ == 0) return nullptr;
-  CompilationJob* job = input_queue_[InputQueueIndex(0)];
+// static
+int OptimizingCompileDispatcher::JobPriority(CompilationJob* job) {
+  CompilationInfo* info = job->compilation_info();
+  if (info->is_osr()) return kMaxInt;
+  FeedbackVector* vector = info->closure()->feedback_vector();
+  const int kMaxTicks = (kMaxInt >> 16) - 1;
+  const int kMaxInvocations = 0xFFFF;
+  return (std::min(vector->profiler_ticks(), kMaxTicks) << 16) |
+         std::min(vector->invocation_count(), kMaxInvocations);
+}
+
+CompilationJob* OptimizingCompileDispatcher::RemoveInput(int i) {
+  DCHECK_LE(0, i);
+  DCHECK_LT(i, input_queue_length_);
+  CompilationJob* job = input_queue_[InputQueueIndex(i)];
   DCHECK_NOT_NULL(job);
+  // Fill the hole with the front job and drop the front.
+  input_queue_[InputQueueIndex(i)] = input_queue_[InputQueueIndex(0)];
+  input_queue_priorities_[InputQueueIndex(i)] =
+      input_queue_priorities_[InputQueueIndex(0)];
   input_queue_shift_ = InputQueueIndex(1);
   input_queue_length_--;
+  return job;
+}
+
+CompilationJob* OptimizingCompileDispatcher::NextInput(bool check_if_flushing) {
+  base::LockGuard<base::Mutex> access_input_queue_(&input_queue_mutex_);
+  if (input_queue_length_ == 0) return nullptr;
+  int next = 0;
+  if (FLAG_concurrent_recompilation_priority) {
+    for (int i = 1; i < input_queue_length_; i++) {
+      if (input_queue_priorities_[InputQueueIndex(i)] >
+          input_queue_priorities_[InputQueueIndex(next)]) {
+        next = i;
+      }
+    }
+  }
+  CompilationJob* job = RemoveInput(next);
   if (check_if_flushing) {
     if (static_cast<ModeFlag>(base::Acquire_Load(&mode_)) == FLUSH) {
       AllowHandleDereference allow_handle_dereference;
@@ -212,13 +246,47 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
   }
 }
 
+bool OptimizingCompileDispatcher::MakeRoomFor(CompilationJob* job) {
+  if (IsQueueAvailable()) return true;
+  if (!FLAG_concurrent_recompilation_priority) return false;
+  int priority = JobPriority(job);
+  CompilationJob* evicted = nullptr;
+  {
+    base::LockGuard<base::Mutex> access_input_queue(&input_queue_mutex_);
+    // A background task may have taken a job in the meantime.
+    if (input_queue_length_ < input_queue_capacity_) return true;
+    int coldest = 0;
+    for (int i = 1; i < input_queue_length_; i++) {
+      if (input_queue_priorities_[InputQueueIndex(i)] <
+          input_queue_priorities_[InputQueueIndex(coldest)]) {
+        coldest = i;
+      }
+    }
+    if (input_queue_priorities_[InputQueueIndex(coldest)] >= priority) {
+      return false;
+    }
+    evicted = RemoveInput(coldest);
+  }
+  // The compile task posted for the evicted job picks up another job or
+  // finds the queue empty.
+  if (FLAG_trace_concurrent_recompilation) {
+    PrintF("  ** Dropped ");
+    evicted->compilation_info()->closure()->ShortPrint();
+    PrintF(" from the compilation queue to make room for a hotter function.\n");
+  }
+  DisposeCompilationJob(evicted, true);
+  return true;
+}
+
 void OptimizingCompileDispatcher::QueueForOptimization(CompilationJob* job) {
   DCHECK(IsQueueAvailable());
+  int priority = FLAG_concurrent_recompilation_priority ? JobPriority(job) : 0;
   {
     // Add job to the back of the input queue.
     base::LockGuard<base::Mutex> access_input_queue(&input_queue_mutex_);
     DCHECK_LT(input_queue_length_, input_queue_capacity_);
     input_queue_[InputQueueIndex(input_queue_length_)] = job;
+    input_queue_priorities_[InputQueueIndex(input_queue_length_)] = priority;
     input_queue_length_++;
   }
   if (FLAG_block_concurrent_recompilation) {
@@ -33,6 +33,7 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
         recompilation_delay_(FLAG_concurrent_recompilation_delay) {
     base::Relaxed_Store(&mode_, static_cast<base::AtomicWord>(COMPILE));
     input_queue_ = NewArray<CompilationJob*>(input_queue_capacity_);
+    input_queue_priorities_ = NewArray<int>(input_queue_capacity_);
   }
 
   ~OptimizingCompileDispatcher();
@@ -49,6 +50,11 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
     return input_queue_length_ < input_queue_capacity_;
   }
 
+  // Returns true if the queue has room for |job|. With
+  // --concurrent-recompilation-priority, a full queue makes room by dropping
+  // its coldest job if that job is colder than |job|.
+  bool MakeRoomFor(CompilationJob* job);
+
   static bool Enabled() { return FLAG_concurrent_recompilation; }
 
  private:
@@ -59,6 +65,12 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   void FlushOutputQueue(bool restore_function_code);
   void CompileNext(CompilationJob* job);
   CompilationJob* NextInput(bool check_if_flushing = false);
+  // Removes the job at queue position |i| and returns it. Requires the input
+  // queue mutex.
+  CompilationJob* RemoveInput(int i);
+
+  // Ranks jobs by profiler ticks, then invocation count. OSR jobs come first.
+  static int JobPriority(CompilationJob* job);
 
   inline int InputQueueIndex(int i) {
     int result = (i + input_queue_shift_) % input_queue_capacity_;
@@ -71,6 +83,9 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   // Circular queue of incoming recompilation tasks (including OSR).
   CompilationJob** input_queue_;
+  // Priorities of the jobs in |input_queue_|, computed on the main thread
+  // when the job is queued.
+  int* input_queue_priorities_;
   int input_queue_capacity_;
   int input_queue_length_;
   int input_queue_shift_;
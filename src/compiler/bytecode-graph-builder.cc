@@ -2661,8 +2661,17 @@ void BytecodeGraphBuilder::BuildSwitchOnSmi(Node* condition) {
 void BytecodeGraphBuilder::VisitSwitchOnSmiNoFeedback() {
   PrepareEagerCheckpoint();
 
+  // Accumulator values that are not Smis fall through to the next bytecode.
   Node* acc = environment()->LookupAccumulator();
-  Node* acc_smi = NewNode(simplified()->CheckSmi(VectorSlotPair()), acc);
+  NewBranch(NewNode(simplified()->ObjectIsSmi(), acc));
+  {
+    SubEnvironment sub_environment(this);
+    NewIfFalse();
+    MergeIntoSuccessorEnvironment(bytecode_iterator().current_offset() +
+                                  bytecode_iterator().current_bytecode_size());
+  }
+  NewIfTrue();
+  Node* acc_smi = NewNode(common()->TypeGuard(Type::SignedSmall()), acc);
   BuildSwitchOnSmi(acc_smi);
 }
 
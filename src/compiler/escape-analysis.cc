@@ -515,6 +515,68 @@ Maybe<int> OffsetOfElementsAccess(const Operator* op, Node* index_node) {
                                         access.machine_type.representation())));
 }
 
+// Elements loads from a virtual object whose index is only known to lie in a
+// small range are replaced by a chain of {Select}s over the candidate fields.
+static const int kMaxVariableIndexRange = 4;
+
+bool RangeOfElementsAccess(const Operator* op, Node* index_node, int* min_index,
+                           int* max_index) {
+  DCHECK_EQ(IrOpcode::kLoadElement, op->opcode());
+  Type* index_type = NodeProperties::GetType(index_node);
+  if (!index_type->Is(Type::Integral32())) return false;
+  double min = index_type->Min();
+  double max = index_type->Max();
+  if (min < 0 || max - min >= kMaxVariableIndexRange) return false;
+  *min_index = static_cast<int>(min);
+  *max_index = static_cast<int>(max);
+  return true;
+}
+
+Node* LowerVariableIndexLoad(const Operator* op, Node* index,
+                             int min_index, int max_index,
+                             const VirtualObject* vobject,
+                             EscapeAnalysisTracker::Scope* current,
+                             JSGraph* jsgraph) {
+  ElementAccess access = ElementAccessOf(op);
+  int element_size_log2 =
+      ElementSizeLog2Of(access.machine_type.representation());
+  DCHECK_GE(element_size_log2, kPointerSizeLog2);
+  Node* values[kMaxVariableIndexRange];
+  for (int i = min_index; i <= max_index; ++i) {
+    Variable var;
+    Node* value;
+    int offset = access.header_size + (i << element_size_log2);
+    // While a loop is still being analyzed, a field can be undefined at the
+    // loop header, which is represented by a nullptr value.
+    if (!vobject->FieldAt(offset).To(&var) || !current->Get(var).To(&value) ||
+        value == nullptr) {
+      return nullptr;
+    }
+    values[i - min_index] = value;
+  }
+  Graph* graph = jsgraph->graph();
+  Node* replacement = values[max_index - min_index];
+  for (int i = max_index - 1; i >= min_index; --i) {
+    Node* value = values[i - min_index];
+    // The selected values flow into a new node, so they have to be
+    // materialized if they are virtual objects themselves.
+    current->SetEscaped(value);
+    Node* comparison = graph->NewNode(jsgraph->simplified()->NumberEqual(),
+                                      index, jsgraph->Constant(i));
+    NodeProperties::SetType(comparison, Type::Boolean());
+    Node* select = graph->NewNode(
+        jsgraph->common()->Select(access.machine_type.representation()),
+        comparison, value, replacement);
+    NodeProperties::SetType(
+        select, Type::Union(NodeProperties::GetType(value),
+                            NodeProperties::GetType(replacement),
+                            graph->zone()));
+    replacement = select;
+  }
+  current->SetEscaped(values[max_index - min_index]);
+  return replacement;
+}
+
 Node* LowerCompareMapsWithoutLoad(Node* checked_map,
                                   ZoneHandleSet<Map> const& checked_against,
                                   JSGraph* jsgraph) {
@@ -617,9 +679,20 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
           OffsetOfElementsAccess(op, index).To(&offset) &&
           vobject->FieldAt(offset).To(&var) && current->Get(var).To(&value)) {
         current->SetReplacement(value);
-      } else {
-        current->SetEscaped(object);
+        break;
       }
+      int min_index;
+      int max_index;
+      if (FLAG_turbo_escape_variable_index && vobject &&
+          !vobject->HasEscaped() &&
+          RangeOfElementsAccess(op, index, &min_index, &max_index)) {
+        if (Node* replacement = LowerVariableIndexLoad(
+                op, index, min_index, max_index, vobject, current, jsgraph)) {
+          current->SetReplacement(replacement);
+          break;
+        }
+      }
+      current->SetEscaped(object);
       break;
     }
     case IrOpcode::kTypeGuard: {
@@ -349,16 +349,37 @@ class PipelineData {
                                   : LoadPoisoning::kDontPoison);
   }
 
-  void BeginPhaseKind(const char* phase_kind_name) {
+  // If {histogram} is given, the wall time of the phase kind is sampled into
+  // it until the next phase kind begins or {StopPhaseKindTimer} is called.
+  void BeginPhaseKind(const char* phase_kind_name,
+                      TimedHistogram* histogram = nullptr) {
     if (pipeline_statistics() != nullptr) {
       pipeline_statistics()->BeginPhaseKind(phase_kind_name);
     }
+    StopPhaseKindTimer();
+    if (histogram != nullptr) {
+      phase_kind_histogram_ = histogram;
+      histogram->Start(&phase_kind_timer_, nullptr);
+    }
   }
 
   void EndPhaseKind() {
     if (pipeline_statistics() != nullptr) {
       pipeline_statistics()->EndPhaseKind();
     }
+    StopPhaseKindTimer();
+  }
+
+  void StopPhaseKindTimer() {
+    if (phase_kind_histogram_ == nullptr) return;
+    phase_kind_histogram_->Stop(&phase_kind_timer_, nullptr);
+    phase_kind_histogram_ = nullptr;
+  }
+
+  // Phase kind histograms only cover JavaScript optimization; stubs and wasm
+  // code are accounted for by their own counters.
+  TimedHistogram* OptimizingHistogram(TimedHistogram* histogram) const {
+    return info()->IsOptimizing() ? histogram : nullptr;
   }
 
   const char* debug_name() const { return debug_name_.get(); }
@@ -370,6 +391,8 @@ class PipelineData {
   bool may_have_unverifiable_graph_ = true;
   ZoneStats* const zone_stats_;
   PipelineStatistics* pipeline_statistics_ = nullptr;
+  TimedHistogram* phase_kind_histogram_ = nullptr;
+  base::ElapsedTimer phase_kind_timer_;
   bool compilation_failed_ = false;
   bool verify_graph_ = false;
   int start_source_position_ = kNoSourcePosition;
@@ -834,6 +857,8 @@ PipelineCompilationJob::Status PipelineCompilationJob::PrepareJobImpl(
 PipelineCompilationJob::Status PipelineCompilationJob::ExecuteJobImpl() {
   if (!pipeline_.OptimizeGraph(linkage_)) return FAILED;
   pipeline_.AssembleCode(linkage_);
+  data_.isolate()->counters()->turbofan_peak_zone_memory_bytes()->AddSample(
+      static_cast<int>(zone_stats_.GetMaxAllocatedBytes()));
   return SUCCEEDED;
 }
 
@@ -1806,7 +1831,10 @@ void PipelineImpl::RunPrintAndVerify(const char* phase, bool untyped) {
 bool PipelineImpl::CreateGraph() {
   PipelineData* data = this->data_;
 
-  data->BeginPhaseKind("graph creation");
+  data->BeginPhaseKind(
+      "graph creation",
+      data->OptimizingHistogram(
+          isolate()->counters()->turbofan_graph_creation_time()));
 
   if (FLAG_trace_turbo || FLAG_trace_turbo_graph) {
     CodeTracer::Scope tracing_scope(isolate()->GetCodeTracer());
@@ -1871,7 +1899,10 @@ bool PipelineImpl::CreateGraph() {
 bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
   PipelineData* data = this->data_;
 
-  data->BeginPhaseKind("lowering");
+  data->BeginPhaseKind(
+      "lowering",
+      data->OptimizingHistogram(
+          isolate()->counters()->turbofan_lowering_time()));
 
   if (data->info()->is_loop_peeling_enabled()) {
     Run<LoopPeelingPhase>();
@@ -1919,7 +1950,10 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
   Run<GenericLoweringPhase>();
   RunPrintAndVerify("Generic lowering", true);
 
-  data->BeginPhaseKind("block building");
+  data->BeginPhaseKind(
+      "block building",
+      data->OptimizingHistogram(
+          isolate()->counters()->turbofan_block_building_time()));
 
   // Run early optimization pass.
   Run<EarlyOptimizationPhase>();
@@ -2182,7 +2216,10 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
 
   data->DeleteGraphZone();
 
-  data->BeginPhaseKind("register allocation");
+  data->BeginPhaseKind(
+      "register allocation",
+      data->OptimizingHistogram(
+          isolate()->counters()->turbofan_register_allocation_time()));
 
   bool run_verifier = FLAG_turbo_verify_allocation;
 
@@ -2225,9 +2262,13 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
 
 void PipelineImpl::AssembleCode(Linkage* linkage) {
   PipelineData* data = this->data_;
-  data->BeginPhaseKind("code generation");
+  data->BeginPhaseKind(
+      "code generation",
+      data->OptimizingHistogram(
+          isolate()->counters()->turbofan_code_generation_time()));
   data->InitializeCodeGenerator(linkage);
   Run<AssembleCodePhase>();
+  data->StopPhaseKindTimer();
   data->DeleteInstructionZone();
 }
 
@@ -2324,14 +2365,22 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
               ->RangesDefinedInDeferredStayInDeferred());
   }
 
-  if (FLAG_turbo_preprocess_ranges) {
+  // Very large functions skip the optional live range preprocessing and gap
+  // move optimization, so that allocation time stays bounded.
+  bool fast_allocation =
+      FLAG_turbo_fast_regalloc_threshold > 0 &&
+      data->sequence()->LastInstructionIndex() >
+          FLAG_turbo_fast_regalloc_threshold;
+  bool preprocess_ranges = FLAG_turbo_preprocess_ranges && !fast_allocation;
+
+  if (preprocess_ranges) {
     Run<SplinterLiveRangesPhase>();
   }
 
   Run<AllocateGeneralRegistersPhase<LinearScanAllocator>>();
   Run<AllocateFPRegistersPhase<LinearScanAllocator>>();
 
-  if (FLAG_turbo_preprocess_ranges) {
+  if (preprocess_ranges) {
     Run<MergeSplintersPhase>();
   }
 
@@ -2349,7 +2398,7 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
   Run<PopulateReferenceMapsPhase>();
   Run<ConnectRangesPhase>();
   Run<ResolveControlFlowPhase>();
-  if (FLAG_turbo_move_optimization) {
+  if (FLAG_turbo_move_optimization && !fast_allocation) {
     Run<OptimizeMovesPhase>();
   }
 
@@ -311,6 +311,7 @@ int InstructionScheduler::GetTargetInstructionFlags(
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
   // Basic latency modeling for x64 instructions. They have been determined
   // in an empirical way.
+  static const int kL1LoadLatency = 4;
   switch (instr->arch_opcode()) {
     case kSSEFloat64Mul:
       return 5;
@@ -363,7 +364,38 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
       return 50;
     case kArchTruncateDoubleToI:
       return 6;
+    case kX64Lea:
+    case kX64Lea32:
+      return 1;
+    case kX64Movsxbl:
+    case kX64Movzxbl:
+    case kX64Movsxbq:
+    case kX64Movzxbq:
+    case kX64Movsxwl:
+    case kX64Movzxwl:
+    case kX64Movsxwq:
+    case kX64Movzxwq:
+    case kX64Movsxlq:
+    case kX64Movl:
+    case kX64Movq:
+    case kX64Movsd:
+    case kX64Movss:
+    case kX64Movdqu:
+      // Loads are assumed to hit the L1 cache; stores and register moves do
+      // not produce a value that later instructions wait for. The scheduler
+      // runs before register allocation, so only the addressing mode tells
+      // loads apart from moves.
+      if (instr->HasOutput() && instr->addressing_mode() != kMode_None) {
+        return kL1LoadLatency;
+      }
+      return 1;
+    case kX64Peek:
+      return kL1LoadLatency;
     default:
+      // ALU operations with a memory operand have to wait for the load.
+      if (instr->addressing_mode() != kMode_None && instr->HasOutput()) {
+        return kL1LoadLatency + 1;
+      }
       return 1;
   }
 }
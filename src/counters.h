@@ -1105,10 +1105,10 @@ class RuntimeCallTimerScope {
   HR(code_cache_reject_reason, V8.CodeCacheRejectReason, 1, 6, 6)              \
   HR(errors_thrown_per_context, V8.ErrorsThrownPerContext, 0, 200, 20)         \
   HR(debug_feature_usage, V8.DebugFeatureUsage, 1, 7, 7)                       \
-  HR(incremental_marking_reason, V8.GCIncrementalMarkingReason, 0, 21, 22)     \
+  HR(incremental_marking_reason, V8.GCIncrementalMarkingReason, 0, 23, 24)     \
   HR(incremental_marking_sum, V8.GCIncrementalMarkingSum, 0, 10000, 101)       \
-  HR(mark_compact_reason, V8.GCMarkCompactReason, 0, 21, 22)                   \
-  HR(scavenge_reason, V8.GCScavengeReason, 0, 21, 22)                          \
+  HR(mark_compact_reason, V8.GCMarkCompactReason, 0, 23, 24)                   \
+  HR(scavenge_reason, V8.GCScavengeReason, 0, 23, 24)                          \
   HR(young_generation_handling, V8.GCYoungGenerationHandling, 0, 2, 3)         \
   /* Asm/Wasm. */                                                              \
   HR(wasm_functions_per_asm_module, V8.WasmFunctionsPerModule.asm, 1, 100000,  \
@@ -1143,7 +1143,10 @@ class RuntimeCallTimerScope {
      20)                                                                       \
   HR(wasm_lazy_compilation_throughput, V8.WasmLazyCompilationThroughput, 1,    \
      10000, 50)                                                                \
-  HR(compile_script_cache_behaviour, V8.CompileScript.CacheBehaviour, 0, 19, 20)
+  HR(compile_script_cache_behaviour, V8.CompileScript.CacheBehaviour, 0, 19,   \
+     20)                                                                       \
+  HR(turbofan_peak_zone_memory_bytes, V8.TurboFanPeakZoneMemoryBytes, 1, GB,   \
+     51)
 
 #define HISTOGRAM_TIMER_LIST(HT)                                               \
   /* Garbage collection timers. */                                             \
@@ -1204,6 +1207,17 @@ class RuntimeCallTimerScope {
      V8.WasmInstantiateModuleMicroSeconds.wasm, 10000000, MICROSECOND)         \
   HT(wasm_instantiate_asm_module_time,                                         \
      V8.WasmInstantiateModuleMicroSeconds.asm, 10000000, MICROSECOND)          \
+  /* TurboFan phase kinds for JavaScript optimization. */                      \
+  HT(turbofan_graph_creation_time, V8.TurboFanGraphCreationMicroSeconds,       \
+     1000000, MICROSECOND)                                                     \
+  HT(turbofan_lowering_time, V8.TurboFanLoweringMicroSeconds, 1000000,         \
+     MICROSECOND)                                                              \
+  HT(turbofan_block_building_time, V8.TurboFanBlockBuildingMicroSeconds,       \
+     1000000, MICROSECOND)                                                     \
+  HT(turbofan_register_allocation_time,                                        \
+     V8.TurboFanRegisterAllocationMicroSeconds, 1000000, MICROSECOND)          \
+  HT(turbofan_code_generation_time, V8.TurboFanCodeGenerationMicroSeconds,     \
+     1000000, MICROSECOND)                                                     \
   /* Total compilation time incl. caching/parsing for various cache states. */ \
   HT(compile_script_with_produce_cache,                                        \
      V8.CompileScriptMicroSeconds.ProduceCache, 1000000, MICROSECOND)          \
@@ -1325,6 +1339,8 @@ class RuntimeCallTimerScope {
   SC(ic_keyed_call_miss, V8.ICKeyedCallMiss)                                   \
   SC(ic_store_miss, V8.ICStoreMiss)                                            \
   SC(ic_keyed_store_miss, V8.ICKeyedStoreMiss)                                 \
+  SC(descriptor_lookup_cache_hits, V8.DescriptorLookupCacheHits)               \
+  SC(descriptor_lookup_cache_misses, V8.DescriptorLookupCacheMisses)           \
   SC(cow_arrays_converted, V8.COWArraysConverted)                              \
   SC(constructed_objects, V8.ConstructedObjects)                               \
   SC(constructed_objects_runtime, V8.ConstructedObjectsRuntime)                \
@@ -1348,6 +1364,8 @@ class RuntimeCallTimerScope {
   SC(math_pow_runtime, V8.MathPowRuntime)                                      \
   SC(stack_interrupts, V8.StackInterrupts)                                     \
   SC(runtime_profiler_ticks, V8.RuntimeProfilerTicks)                          \
+  /* Samples the CPU profiler dropped because its buffer was full. */          \
+  SC(cpu_profiler_dropped_samples, V8.CpuProfilerDroppedSamples)               \
   SC(runtime_calls, V8.RuntimeCalls)                                           \
   SC(bounds_checks_eliminated, V8.BoundsChecksEliminated)                      \
   SC(bounds_checks_hoisted, V8.BoundsChecksHoisted)                            \
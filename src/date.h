@@ -222,8 +222,10 @@ class DateCache {
   // September 30.
   static const int kDefaultDSTDeltaInSec = 19 * kSecPerDay;
 
-  // Size of the Daylight Savings Time cache.
-  static const int kDSTSize = 32;
+  // Size of the Daylight Savings Time cache. Each year typically needs two
+  // segments, so this covers several decades of timestamps without going
+  // back to the OS.
+  static const int kDSTSize = 128;
 
   // Daylight Savings Time segment stores a segment of time where
   // daylight savings offset does not change.
@@ -154,10 +154,17 @@ void CopyObjectToObjectElements(FixedArrayBase* from_base,
       (IsObjectElementsKind(from_kind) && IsObjectElementsKind(to_kind))
           ? UPDATE_WRITE_BARRIER
           : SKIP_WRITE_BARRIER;
-  for (int i = 0; i < copy_size; i++) {
-    Object* value = from->get(from_start + i);
-    to->set(to_start + i, value, write_barrier_mode);
+  if (from == to) {
+    for (int i = 0; i < copy_size; i++) {
+      Object* value = from->get(from_start + i);
+      to->set(to_start + i, value, write_barrier_mode);
+    }
+    return;
   }
+  // Copy the whole range at once and record the write barrier for the
+  // destination range in one step instead of once per element.
+  to->GetHeap()->CopyElements(to, from, to_start, from_start, copy_size,
+                              write_barrier_mode);
 }
 
 
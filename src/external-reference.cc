@@ -534,6 +534,11 @@ ExternalReference ExternalReference::address_of_float_neg_constant(
   return ExternalReference(reinterpret_cast<void*>(&float_negate_constant));
 }
 
+ExternalReference ExternalReference::address_of_harmony_await_optimization_flag(
+    Isolate* isolate) {
+  return ExternalReference(&FLAG_harmony_await_optimization);
+}
+
 ExternalReference ExternalReference::address_of_double_abs_constant(
     Isolate* isolate) {
   return ExternalReference(reinterpret_cast<void*>(&double_absolute_constant));
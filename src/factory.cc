@@ -450,9 +450,9 @@ MaybeHandle<String> Factory::NewStringFromUtf8(Vector<const char> string,
 
   // Copy ASCII portion.
   uint16_t* data = result->GetChars();
-  for (int i = 0; i < non_ascii_start; i++) {
-    *data++ = *ascii_data++;
-  }
+  CopyChars(data, reinterpret_cast<const uint8_t*>(ascii_data),
+            non_ascii_start);
+  data += non_ascii_start;
 
   // Now write the remainder.
   decoder->WriteUtf16(data, utf16_length, non_ascii);
@@ -495,9 +495,9 @@ MaybeHandle<String> Factory::NewStringFromUtf8SubString(
 
   // Copy ASCII portion.
   uint16_t* data = result->GetChars();
-  for (int i = 0; i < non_ascii_start; i++) {
-    *data++ = *ascii_data++;
-  }
+  CopyChars(data, reinterpret_cast<const uint8_t*>(ascii_data),
+            non_ascii_start);
+  data += non_ascii_start;
 
   // Now write the remainder.
   decoder->WriteUtf16(data, utf16_length, non_ascii);
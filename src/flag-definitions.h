@@ -213,7 +213,8 @@ DEFINE_IMPLICATION(harmony_class_fields, harmony_private_fields)
   V(harmony_do_expressions, "harmony do-expressions")                 \
   V(harmony_class_fields, "harmony fields in class literals")         \
   V(harmony_static_fields, "harmony static fields in class literals") \
-  V(harmony_array_flatten, "harmony Array.prototype.flat{ten,Map}")
+  V(harmony_array_flatten, "harmony Array.prototype.flat{ten,Map}")   \
+  V(harmony_await_optimization, "harmony await taking 1 tick")
 
 // Features that are complete (but still behind --harmony/es-staging flag).
 #define HARMONY_STAGED(V)                                               \
@@ -289,6 +290,9 @@ DEFINE_IMPLICATION(future, write_protect_code_memory)
 // Flags for experimental implementation features.
 DEFINE_BOOL(allocation_site_pretenuring, true,
             "pretenure with allocation sites")
+DEFINE_BOOL(allocation_site_pretenuring_revisit, false,
+            "reconsider don't-tenure decisions of allocation sites whose "
+            "objects start surviving")
 DEFINE_BOOL(page_promotion, true, "promote pages based on utilization")
 DEFINE_INT(page_promotion_threshold, 70,
            "min percentage of live bytes on a page to enable fast evacuation")
@@ -296,6 +300,9 @@ DEFINE_BOOL(trace_pretenuring, false,
             "trace pretenuring decisions of HAllocate instructions")
 DEFINE_BOOL(trace_pretenuring_statistics, false,
             "trace allocation site pretenuring statistics")
+DEFINE_BOOL(trace_pretenuring_json, false,
+            "print pretenuring feedback and decisions of allocation sites "
+            "as one JSON object per line")
 DEFINE_BOOL(track_fields, true, "track fields with only smi values")
 DEFINE_BOOL(track_double_fields, true, "track fields with double values")
 DEFINE_BOOL(track_heap_object_fields, true, "track fields with heap values")
@@ -378,6 +385,9 @@ DEFINE_BOOL(trace_concurrent_recompilation, false,
             "track concurrent recompilation")
 DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
+DEFINE_BOOL(concurrent_recompilation_priority, false,
+            "compile the hottest queued functions first and let hot functions "
+            "replace cold ones in a full queue")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
 DEFINE_BOOL(block_concurrent_recompilation, false,
@@ -394,6 +404,9 @@ DEFINE_BOOL(turbo_sp_frame_access, false,
             "use stack pointer-relative access to frame wherever possible")
 DEFINE_BOOL(turbo_preprocess_ranges, true,
             "run pre-register allocation heuristics")
+DEFINE_INT(turbo_fast_regalloc_threshold, 0,
+           "skip optional register allocation heuristics for functions with "
+           "more instructions than this (0 means never)")
 DEFINE_STRING(turbo_filter, "*", "optimization filter for TurboFan compiler")
 DEFINE_BOOL(trace_turbo, false, "trace generated TurboFan IR")
 DEFINE_BOOL(trace_turbo_graph, false, "trace generated TurboFan graphs")
@@ -478,6 +491,9 @@ DEFINE_BOOL(turbo_loop_peeling, true, "Turbofan loop peeling")
 DEFINE_BOOL(turbo_loop_variable, true, "Turbofan loop variable optimization")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
+DEFINE_BOOL(turbo_escape_variable_index, false,
+            "scalar-replace small-range variable-index loads in escape "
+            "analysis")
 DEFINE_BOOL(turbo_instruction_scheduling, false,
             "enable instruction scheduling in TurboFan")
 DEFINE_BOOL(turbo_stress_instruction_scheduling, false,
@@ -633,6 +649,12 @@ DEFINE_INT(semi_space_growth_factor, 2, "factor by which to grow the new space")
 DEFINE_BOOL(experimental_new_space_growth_heuristic, false,
             "Grow the new space based on the percentage of survivors instead "
             "of their absolute value.")
+DEFINE_BOOL(adaptive_new_space_size, false,
+            "resize the new space after each GC to meet the scavenge overhead "
+            "target based on survival and allocation rates")
+DEFINE_INT(scavenge_overhead_target, 5,
+           "target percentage of mutator time spent in scavenges for "
+           "--adaptive-new-space-size")
 DEFINE_SIZE_T(max_old_space_size, 0, "max size of the old space (in Mbytes)")
 DEFINE_SIZE_T(initial_old_space_size, 0, "initial old space size (in Mbytes)")
 DEFINE_BOOL(gc_global, false, "always perform global GCs")
@@ -670,7 +692,16 @@ DEFINE_BOOL(incremental_marking, true, "use incremental marking")
 DEFINE_BOOL(incremental_marking_wrappers, true,
             "use incremental marking for marking wrappers")
 DEFINE_BOOL(trace_unmapper, false, "Trace the unmapping")
+DEFINE_BOOL(huge_pages, false,
+            "reserve old, map and code space in huge page aligned regions "
+            "and ask the OS to back them with transparent huge pages")
+DEFINE_BOOL(shared_page_pool, false,
+            "share pooled pages between isolates of this process")
+DEFINE_INT(shared_page_pool_max_pages, 256,
+           "maximum number of pages retained by the shared page pool")
 DEFINE_BOOL(parallel_scavenge, true, "parallel scavenge")
+DEFINE_BOOL(parallel_scavenge_global_handles, true,
+            "process strong global handles in parallel during scavenge")
 DEFINE_BOOL(trace_parallel_scavenge, false, "trace parallel scavenge")
 DEFINE_BOOL(write_protect_code_memory, true, "write protect code memory")
 #ifdef V8_CONCURRENT_MARKING
@@ -688,6 +719,12 @@ DEFINE_BOOL(minor_mc_parallel_marking, true,
 DEFINE_BOOL(trace_minor_mc_parallel_marking, false,
             "trace parallel marking for the young generation")
 DEFINE_BOOL(minor_mc, false, "perform young generation mark compact GCs")
+DEFINE_BOOL(scavenge_task, false,
+            "schedule young generation GCs from a task once new space "
+            "occupancy reaches --scavenge-task-trigger")
+DEFINE_INT(scavenge_task_trigger, 80,
+           "new space occupancy in percent of its capacity at which a young "
+           "generation GC task is posted")
 DEFINE_BOOL(black_allocation, true, "use black allocation")
 DEFINE_BOOL(concurrent_store_buffer, true,
             "use concurrent store buffer processing")
@@ -708,6 +745,13 @@ DEFINE_BOOL(track_retaining_path, false,
             "enable support for tracking retaining path")
 DEFINE_BOOL(concurrent_array_buffer_freeing, true,
             "free array buffer allocations on a background thread")
+DEFINE_BOOL(array_buffer_pool, false,
+            "recycle backing stores of dead array buffers for new array "
+            "buffers of the same length")
+DEFINE_SIZE_T(array_buffer_pool_max_length, 64 * KB,
+              "maximum length of backing stores kept in the array buffer pool")
+DEFINE_SIZE_T(array_buffer_pool_size, 16,
+              "maximum size of the array buffer pool (in MBytes)")
 DEFINE_INT(gc_stats, 0, "Used by tracing internally to enable gc statistics")
 DEFINE_IMPLICATION(trace_gc_object_stats, track_gc_object_stats)
 DEFINE_VALUE_IMPLICATION(track_gc_object_stats, gc_stats, 1)
@@ -728,6 +772,12 @@ DEFINE_BOOL(verify_heap_skip_remembered_set, false,
 #endif
 DEFINE_BOOL(move_object_start, true, "enable moving of object starts")
 DEFINE_BOOL(memory_reducer, true, "use memory reducer")
+DEFINE_BOOL(reduce_memory_when_dormant, false,
+            "return free memory to the OS when the isolate stays in the "
+            "background")
+DEFINE_INT(dormant_isolate_delay, 10,
+           "seconds in the background after which an isolate is considered "
+           "dormant")
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
@@ -735,6 +785,12 @@ DEFINE_BOOL(always_compact, false, "Perform compaction on every full GC")
 DEFINE_BOOL(never_compact, false,
             "Never perform compaction on full GC - testing only")
 DEFINE_BOOL(compact_code_space, true, "Compact code space on full collections")
+DEFINE_BOOL(size_class_allocation, false,
+            "refill small old space allocations from free list entries of "
+            "their own size class before splitting larger entries")
+DEFINE_INT(compaction_pause_budget_ms, 0,
+           "bound the bytes selected for evacuation by the traced compaction "
+           "speed so that evacuation fits into this many ms (0 = no bound)")
 DEFINE_BOOL(use_marking_progress_bar, true,
             "Use a progress bar to scan large objects in increments when "
             "incremental marking is active.")
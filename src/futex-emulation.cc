@@ -19,6 +19,7 @@ namespace internal {
 base::LazyMutex FutexEmulation::mutex_ = LAZY_MUTEX_INITIALIZER;
 base::LazyInstance<FutexWaitList>::type FutexEmulation::wait_list_ =
     LAZY_INSTANCE_INITIALIZER;
+base::AtomicWord FutexEmulation::num_waiters_ = 0;
 
 
 void FutexWaitListNode::NotifyWake() {
@@ -83,7 +84,14 @@ Object* FutexEmulation::Wait(Isolate* isolate,
 
   base::LockGuard<base::Mutex> lock_guard(mutex_.Pointer());
 
+  // Announce the waiter before checking the value. Together with the fence in
+  // Wake this ensures that a Wake racing with this Wait either sees the waiter
+  // or the value stored before it, which makes this thread return
+  // "not-equal".
+  base::Barrier_AtomicIncrement(&num_waiters_, 1);
+
   if (*p != value) {
+    base::Barrier_AtomicIncrement(&num_waiters_, -1);
     return isolate->heap()->not_equal();
   }
 
@@ -183,6 +191,7 @@ Object* FutexEmulation::Wait(Isolate* isolate,
 
   wait_list_.Pointer()->RemoveNode(node);
   node->waiting_ = false;
+  base::Barrier_AtomicIncrement(&num_waiters_, -1);
 
   return result;
 }
@@ -195,6 +204,10 @@ Object* FutexEmulation::Wake(Isolate* isolate,
   int waiters_woken = 0;
   void* backing_store = array_buffer->backing_store();
 
+  // Fast path: nobody is waiting on any address, so there is nothing to wake.
+  base::SeqCst_MemoryFence();
+  if (base::Acquire_Load(&num_waiters_) == 0) return Smi::kZero;
+
   base::LockGuard<base::Mutex> lock_guard(mutex_.Pointer());
   FutexWaitListNode* node = wait_list_.Pointer()->head_;
   while (node && num_waiters_to_wake > 0) {
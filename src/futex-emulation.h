@@ -112,6 +112,11 @@ class FutexEmulation : public AllStatic {
 
   static base::LazyMutex mutex_;
   static base::LazyInstance<FutexWaitList>::type wait_list_;
+
+  // Number of threads currently inside Wait. It is incremented before the
+  // value check, so it may briefly count threads that return "not-equal".
+  // Lets Wake return without taking |mutex_| when nobody is waiting.
+  static base::AtomicWord num_waiters_;
 };
 }  // namespace internal
 }  // namespace v8
@@ -647,7 +647,14 @@ void GlobalHandles::IdentifyWeakHandles(WeakSlotCallback should_reset_handle) {
 }
 
 void GlobalHandles::IterateNewSpaceStrongAndDependentRoots(RootVisitor* v) {
-  for (Node* node : new_space_nodes_) {
+  IterateNewSpaceStrongAndDependentRoots(v, 0, new_space_nodes_.size());
+}
+
+void GlobalHandles::IterateNewSpaceStrongAndDependentRoots(RootVisitor* v,
+                                                           size_t start,
+                                                           size_t end) {
+  for (size_t i = start; i < end; ++i) {
+    Node* node = new_space_nodes_[i];
     if (node->IsStrongRetainer() ||
         (node->IsWeakRetainer() && node->is_active())) {
       v->VisitRootPointer(Root::kGlobalHandles, node->label(),
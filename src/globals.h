@@ -600,6 +600,7 @@ enum VisitMode {
   VISIT_ALL_IN_MINOR_MC_MARK,
   VISIT_ALL_IN_MINOR_MC_UPDATE,
   VISIT_ALL_IN_SCAVENGE,
+  VISIT_ALL_IN_SCAVENGE_EXCEPT_GLOBAL_HANDLES,
   VISIT_ALL_IN_SWEEP_NEWSPACE,
   VISIT_ONLY_STRONG,
   VISIT_FOR_SERIALIZATION,
@@ -20,6 +20,7 @@ void ArrayBufferCollector::FreeAllocations() {
   base::LockGuard<base::Mutex> guard(&allocations_mutex_);
   for (std::vector<JSArrayBuffer::Allocation>* allocations : allocations_) {
     for (auto alloc : *allocations) {
+      if (FLAG_array_buffer_pool && TryAddToPool(alloc)) continue;
       JSArrayBuffer::FreeBackingStore(heap_->isolate(), alloc);
     }
     delete allocations;
@@ -27,6 +28,51 @@ void ArrayBufferCollector::FreeAllocations() {
   allocations_.clear();
 }
 
+bool ArrayBufferCollector::TryAddToPool(
+    const JSArrayBuffer::Allocation& allocation) {
+  if (allocation.mode != ArrayBuffer::Allocator::AllocationMode::kNormal ||
+      allocation.length > FLAG_array_buffer_pool_max_length) {
+    return false;
+  }
+  const size_t max_pool_size = FLAG_array_buffer_pool_size * MB;
+  {
+    base::LockGuard<base::Mutex> guard(&pool_mutex_);
+    if (pool_size_ + allocation.length > max_pool_size) return false;
+    // Reserve the space before clearing the memory outside of the lock.
+    pool_size_ += allocation.length;
+  }
+  memset(allocation.allocation_base, 0, allocation.length);
+  base::LockGuard<base::Mutex> guard(&pool_mutex_);
+  pool_[allocation.length].push_back(allocation.allocation_base);
+  return true;
+}
+
+void* ArrayBufferCollector::TryAllocateFromPool(size_t length) {
+  base::LockGuard<base::Mutex> guard(&pool_mutex_);
+  auto it = pool_.find(length);
+  if (it == pool_.end() || it->second.empty()) return nullptr;
+  void* data = it->second.back();
+  it->second.pop_back();
+  pool_size_ -= length;
+  return data;
+}
+
+void ArrayBufferCollector::ReleasePool() {
+  base::LockGuard<base::Mutex> guard(&pool_mutex_);
+  for (auto& entry : pool_) {
+    for (void* data : entry.second) {
+      heap_->isolate()->array_buffer_allocator()->Free(data, entry.first);
+      pool_size_ -= entry.first;
+    }
+  }
+  pool_.clear();
+}
+
+size_t ArrayBufferCollector::pool_size() {
+  base::LockGuard<base::Mutex> guard(&pool_mutex_);
+  return pool_size_;
+}
+
 class ArrayBufferCollector::FreeingTask final : public CancelableTask {
  public:
   explicit FreeingTask(Heap* heap)
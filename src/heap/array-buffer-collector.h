@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_ARRAY_BUFFER_COLLECTOR_H_
 #define V8_HEAP_ARRAY_BUFFER_COLLECTOR_H_
 
+#include <unordered_map>
 #include <vector>
 
 #include "src/base/platform/mutex.h"
@@ -19,11 +20,18 @@ class Heap;
 // array buffers using the ArrayBufferTracker class. The ArrayBufferCollector
 // keeps track of garbage backing stores so that they can be freed on a
 // background thread.
+//
+// With --array-buffer-pool, small garbage backing stores are not freed but
+// cleared on the background thread and kept in per-length free lists, from
+// which new array buffers of the same length are allocated.
 class ArrayBufferCollector {
  public:
-  explicit ArrayBufferCollector(Heap* heap) : heap_(heap) {}
+  explicit ArrayBufferCollector(Heap* heap) : heap_(heap), pool_size_(0) {}
 
-  ~ArrayBufferCollector() { FreeAllocations(); }
+  ~ArrayBufferCollector() {
+    FreeAllocations();
+    ReleasePool();
+  }
 
   // These allocations will begin to be freed once FreeAllocations() is called,
   // or on TearDown.
@@ -33,6 +41,16 @@ class ArrayBufferCollector {
   // Calls FreeAllocations() on a background thread.
   void FreeAllocationsOnBackgroundThread();
 
+  // Returns a zero-initialized backing store of |length| bytes recycled from
+  // a dead array buffer, or nullptr if the pool holds none.
+  void* TryAllocateFromPool(size_t length);
+
+  // Frees all backing stores held by the pool.
+  void ReleasePool();
+
+  // Returns the number of bytes held by the pool.
+  size_t pool_size();
+
  private:
   class FreeingTask;
 
@@ -40,9 +58,18 @@ class ArrayBufferCollector {
   // called by TearDown.
   void FreeAllocations();
 
+  // Clears the backing store and adds it to the pool if it is eligible and
+  // the pool has room. Returns false if the caller has to free it.
+  bool TryAddToPool(const JSArrayBuffer::Allocation& allocation);
+
   Heap* heap_;
   base::Mutex allocations_mutex_;
   std::vector<std::vector<JSArrayBuffer::Allocation>*> allocations_;
+
+  base::Mutex pool_mutex_;
+  // Maps backing store lengths to free backing stores of that length.
+  std::unordered_map<size_t, std::vector<void*>> pool_;
+  size_t pool_size_;
 };
 
 }  // namespace internal
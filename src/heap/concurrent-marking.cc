@@ -80,7 +80,8 @@ class ConcurrentMarkingVisitor final
         bailout_(bailout, task_id),
         weak_objects_(weak_objects),
         marking_state_(live_bytes),
-        task_id_(task_id) {}
+        task_id_(task_id),
+        bailout_objects_(0) {}
 
   template <typename T>
   static V8_INLINE T* Cast(HeapObject* object) {
@@ -91,6 +92,14 @@ class ConcurrentMarkingVisitor final
     return marking_state_.GreyToBlack(object);
   }
 
+  // Leaves the object to the main thread.
+  void Bailout(HeapObject* object) {
+    bailout_.Push(object);
+    bailout_objects_++;
+  }
+
+  size_t bailout_objects() const { return bailout_objects_; }
+
   void ProcessStrongHeapObject(HeapObject* host, Object** slot,
                                HeapObject* heap_object) {
 #ifdef THREAD_SANITIZER
@@ -187,7 +196,7 @@ class ConcurrentMarkingVisitor final
   int VisitJSApiObject(Map* map, JSObject* object) {
     if (marking_state_.IsGrey(object)) {
       // The main thread will do wrapper tracing in Blink.
-      bailout_.Push(object);
+      Bailout(object);
     }
     return 0;
   }
@@ -261,7 +270,7 @@ class ConcurrentMarkingVisitor final
   // ===========================================================================
 
   int VisitCode(Map* map, Code* object) {
-    bailout_.Push(object);
+    Bailout(object);
     return 0;
   }
 
@@ -303,6 +312,18 @@ class ConcurrentMarkingVisitor final
   }
 
   int VisitMap(Map* meta_map, Map* map) {
+    if (!map->CanTransition()) {
+      // Maps without transitions have neither back pointers nor owned
+      // descriptors, so the main thread visits all their pointer fields
+      // strongly. The instance type of a map never changes, which makes it
+      // safe to do the same here.
+      if (!ShouldVisit(map)) return 0;
+      VisitMapPointer(map, map->map_slot());
+      VisitPointers(map,
+                    HeapObject::RawField(map, Map::kPointerFieldsBeginOffset),
+                    HeapObject::RawField(map, Map::kPointerFieldsEndOffset));
+      return Map::BodyDescriptor::SizeOf(meta_map, map);
+    }
     if (marking_state_.IsGrey(map)) {
       // Maps have ad-hoc weakness for descriptor arrays. They also clear the
       // code-cache. Conservatively visit strong fields skipping the
@@ -315,7 +336,7 @@ class ConcurrentMarkingVisitor final
                             map, Map::kTransitionsOrPrototypeInfoOffset));
       VisitPointer(map, HeapObject::RawField(map, Map::kDependentCodeOffset));
       VisitPointer(map, HeapObject::RawField(map, Map::kWeakCellCacheOffset));
-      bailout_.Push(map);
+      Bailout(map);
     }
     return 0;
   }
@@ -359,7 +380,7 @@ class ConcurrentMarkingVisitor final
 
   int VisitJSWeakCollection(Map* map, JSWeakCollection* object) {
     // TODO(ulan): implement iteration of strong fields.
-    bailout_.Push(object);
+    Bailout(object);
     return 0;
   }
 
@@ -414,6 +435,7 @@ class ConcurrentMarkingVisitor final
   ConcurrentMarkingState marking_state_;
   int task_id_;
   SlotSnapshot slot_snapshot_;
+  size_t bailout_objects_;
 };
 
 // Strings can change maps due to conversion to thin string or external strings.
@@ -543,6 +565,7 @@ void ConcurrentMarking::Run(int task_id, TaskState* task_state) {
     weak_objects_->weak_references.FlushToGlobal(task_id);
     base::AsAtomicWord::Relaxed_Store<size_t>(&task_state->marked_bytes, 0);
     total_marked_bytes_.Increment(marked_bytes);
+    total_bailout_objects_.Increment(visitor.bailout_objects());
     {
       base::LockGuard<base::Mutex> guard(&pending_lock_);
       is_pending_[task_id] = false;
@@ -652,6 +675,7 @@ void ConcurrentMarking::FlushLiveBytes(
     task_state_[i].marked_bytes = 0;
   }
   total_marked_bytes_.SetValue(0);
+  total_bailout_objects_.SetValue(0);
 }
 
 void ConcurrentMarking::ClearLiveness(MemoryChunk* chunk) {
@@ -83,6 +83,10 @@ class ConcurrentMarking {
 
   size_t TotalMarkedBytes();
 
+  // Returns the number of objects that the tasks pushed onto the bailout
+  // worklist since the last FlushLiveBytes().
+  size_t TotalBailoutObjects() { return total_bailout_objects_.Value(); }
+
  private:
   struct TaskState {
     // The main thread sets this flag to true when it wants the concurrent
@@ -102,6 +106,7 @@ class ConcurrentMarking {
   WeakObjects* const weak_objects_;
   TaskState task_state_[kMaxTasks + 1];
   base::AtomicNumber<size_t> total_marked_bytes_{0};
+  base::AtomicNumber<size_t> total_bailout_objects_{0};
   base::Mutex pending_lock_;
   base::ConditionVariable pending_condition_;
   int pending_task_count_ = 0;
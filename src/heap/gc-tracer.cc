@@ -116,7 +116,8 @@ GCTracer::Event::Event(Type type, GarbageCollectionReason gc_reason,
       new_space_object_size(0),
       survived_new_space_object_size(0),
       incremental_marking_bytes(0),
-      incremental_marking_duration(0.0) {
+      incremental_marking_duration(0.0),
+      concurrent_marking_bailouts(0) {
   for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
     scopes[i] = 0;
   }
@@ -143,6 +144,7 @@ GCTracer::GCTracer(Heap* heap)
       previous_(current_),
       incremental_marking_bytes_(0),
       incremental_marking_duration_(0.0),
+      concurrent_marking_bailouts_(0),
       incremental_marking_start_time_(0.0),
       recorded_incremental_marking_speed_(0.0),
       allocation_time_ms_(0.0),
@@ -187,6 +189,7 @@ void GCTracer::ResetForTesting() {
   recorded_old_generation_allocations_.Reset();
   recorded_context_disposal_times_.Reset();
   recorded_survival_ratios_.Reset();
+  recorded_summaries_.Reset();
   start_counter_ = 0;
   base::LockGuard<base::Mutex> guard(&background_counter_mutex_);
   for (int i = 0; i < BackgroundScope::NUMBER_OF_SCOPES; i++) {
@@ -267,6 +270,7 @@ void GCTracer::ResetIncrementalMarkingCounters() {
   }
   incremental_marking_bytes_ = 0;
   incremental_marking_duration_ = 0;
+  concurrent_marking_bailouts_ = 0;
   for (int i = 0; i < Scope::NUMBER_OF_INCREMENTAL_SCOPES; i++) {
     incremental_marking_scopes_[i].ResetCurrentCycle();
   }
@@ -318,6 +322,7 @@ void GCTracer::Stop(GarbageCollector collector) {
     case Event::INCREMENTAL_MARK_COMPACTOR:
       current_.incremental_marking_bytes = incremental_marking_bytes_;
       current_.incremental_marking_duration = incremental_marking_duration_;
+      current_.concurrent_marking_bailouts = concurrent_marking_bailouts_;
       for (int i = 0; i < Scope::NUMBER_OF_INCREMENTAL_SCOPES; i++) {
         current_.incremental_marking_scopes[i] = incremental_marking_scopes_[i];
         current_.scopes[i] = incremental_marking_scopes_[i].duration;
@@ -343,6 +348,7 @@ void GCTracer::Stop(GarbageCollector collector) {
       UNREACHABLE();
   }
   FetchBackgroundGeneralCounters();
+  RecordSummary();
 
   heap_->UpdateTotalGCTime(duration);
 
@@ -428,6 +434,10 @@ void GCTracer::AddIncrementalMarkingStep(double duration, size_t bytes) {
   }
 }
 
+void GCTracer::AddConcurrentMarkingBailouts(size_t objects) {
+  concurrent_marking_bailouts_ += objects;
+}
+
 void GCTracer::Output(const char* format, ...) const {
   if (FLAG_trace_gc) {
     va_list arguments;
@@ -709,6 +719,8 @@ void GCTracer::PrintNVP() const {
           "incremental_steps_count=%d "
           "incremental_marking_throughput=%.f "
           "incremental_walltime_duration=%.f "
+          "concurrent_marking_bailouts=%" PRIuS
+          " "
           "background.mark=%.1f "
           "background.sweep=%.1f "
           "background.evacuate.copy=%.1f "
@@ -808,7 +820,7 @@ void GCTracer::PrintNVP() const {
               .longest_step,
           current_.incremental_marking_scopes[Scope::MC_INCREMENTAL].steps,
           IncrementalMarkingSpeedInBytesPerMillisecond(),
-          incremental_walltime_duration,
+          incremental_walltime_duration, current_.concurrent_marking_bailouts,
           current_.scopes[Scope::MC_BACKGROUND_MARKING],
           current_.scopes[Scope::MC_BACKGROUND_SWEEPING],
           current_.scopes[Scope::MC_BACKGROUND_EVACUATE_COPY],
@@ -1009,6 +1021,45 @@ void GCTracer::FetchBackgroundGeneralCounters() {
                           BackgroundScope::LAST_GENERAL_BACKGROUND_SCOPE);
 }
 
+void GCTracer::RecordSummary() {
+  Summary summary;
+  summary.type = current_.type;
+  summary.gc_reason = current_.gc_reason;
+  summary.start_time = current_.start_time;
+  summary.pause_duration = current_.end_time - current_.start_time;
+  switch (current_.type) {
+    case Event::SCAVENGER:
+      summary.mark_duration = 0;
+      summary.evacuate_duration = current_.scopes[Scope::SCAVENGER_SCAVENGE];
+      summary.sweep_duration = 0;
+      break;
+    case Event::MINOR_MARK_COMPACTOR:
+      summary.mark_duration = current_.scopes[Scope::MINOR_MC_MARK];
+      summary.evacuate_duration = current_.scopes[Scope::MINOR_MC_EVACUATE];
+      summary.sweep_duration = current_.scopes[Scope::MINOR_MC_SWEEPING];
+      break;
+    case Event::MARK_COMPACTOR:
+    case Event::INCREMENTAL_MARK_COMPACTOR:
+      summary.mark_duration = current_.scopes[Scope::MC_MARK];
+      summary.evacuate_duration = current_.scopes[Scope::MC_EVACUATE];
+      summary.sweep_duration = current_.scopes[Scope::MC_SWEEP];
+      break;
+    case Event::START:
+      UNREACHABLE();
+  }
+  summary.incremental_duration = current_.incremental_marking_duration;
+  summary.background_duration = 0;
+  for (int i = Scope::FIRST_GENERAL_BACKGROUND_SCOPE;
+       i <= Scope::LAST_MINOR_GC_BACKGROUND_SCOPE; i++) {
+    summary.background_duration += current_.scopes[i];
+  }
+  summary.start_object_size = current_.start_object_size;
+  summary.end_object_size = current_.end_object_size;
+  summary.promoted_bytes = heap_->promoted_objects_size();
+  summary.survived_bytes = heap_->semi_space_copied_object_size();
+  recorded_summaries_.Push(summary);
+}
+
 void GCTracer::FetchBackgroundCounters(int first_global_scope,
                                        int last_global_scope,
                                        int first_background_scope,
@@ -189,6 +189,10 @@ class V8_EXPORT_PRIVATE GCTracer {
     // Duration of incremental marking steps for INCREMENTAL_MARK_COMPACTOR.
     double incremental_marking_duration;
 
+    // Objects that concurrent marking tasks left to the main thread for
+    // INCREMENTAL_MARK_COMPACTOR.
+    size_t concurrent_marking_bailouts;
+
     // Amounts of time spent in different scopes during GC.
     double scopes[Scope::NUMBER_OF_SCOPES];
 
@@ -197,6 +201,29 @@ class V8_EXPORT_PRIVATE GCTracer {
         incremental_marking_scopes[Scope::NUMBER_OF_INCREMENTAL_SCOPES];
   };
 
+  // Compact summary of a finished GC. The last few summaries are kept for
+  // embedders, see v8::Isolate::GetGCStatistics.
+  struct Summary {
+    Event::Type type;
+    GarbageCollectionReason gc_reason;
+    double start_time;
+    // Wall time of the atomic pause.
+    double pause_duration;
+    // Main thread time of the phases inside the atomic pause. For scavenges
+    // |evacuate_duration| is the scavenging time.
+    double mark_duration;
+    double evacuate_duration;
+    double sweep_duration;
+    // Main thread incremental marking time that preceded the pause.
+    double incremental_duration;
+    // Time spent by background tasks on behalf of this GC, summed over tasks.
+    double background_duration;
+    size_t start_object_size;
+    size_t end_object_size;
+    size_t promoted_bytes;
+    size_t survived_bytes;
+  };
+
   static const int kThroughputTimeFrameMs = 5000;
 
   static RuntimeCallCounterId RCSCounterFromScope(Scope::ScopeId id);
@@ -229,6 +256,9 @@ class V8_EXPORT_PRIVATE GCTracer {
   // Log an incremental marking step.
   void AddIncrementalMarkingStep(double duration, size_t bytes);
 
+  // Log objects that concurrent marking tasks left to the main thread.
+  void AddConcurrentMarkingBailouts(size_t objects);
+
   // Compute the average incremental marking speed in bytes/millisecond.
   // Returns 0 if no events have been recorded.
   double IncrementalMarkingSpeedInBytesPerMillisecond() const;
@@ -300,6 +330,14 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   void NotifyIncrementalMarkingStart();
 
+  // Returns the number of GCs for which a summary is kept.
+  int RecordedSummaryCount() const { return recorded_summaries_.Count(); }
+
+  // Returns the summary of the |index|-th most recent GC, 0 being the last.
+  const Summary& RecordedSummary(int index) const {
+    return recorded_summaries_.Get(index);
+  }
+
   V8_INLINE void AddScopeSample(Scope::ScopeId scope, double duration) {
     DCHECK(scope < Scope::NUMBER_OF_SCOPES);
     if (scope >= Scope::FIRST_INCREMENTAL_SCOPE &&
@@ -324,6 +362,7 @@ class V8_EXPORT_PRIVATE GCTracer {
   FRIEND_TEST(GCTracerTest, NewSpaceAllocationThroughput);
   FRIEND_TEST(GCTracerTest, NewSpaceAllocationThroughputWithProvidedTime);
   FRIEND_TEST(GCTracerTest, OldGenerationAllocationThroughputWithProvidedTime);
+  FRIEND_TEST(GCTracerTest, RecordedSummaries);
   FRIEND_TEST(GCTracerTest, RegularScope);
   FRIEND_TEST(GCTracerTest, IncrementalMarkingDetails);
   FRIEND_TEST(GCTracerTest, IncrementalScope);
@@ -372,6 +411,8 @@ class V8_EXPORT_PRIVATE GCTracer {
   void FetchBackgroundMarkCompactCounters();
   void FetchBackgroundGeneralCounters();
 
+  void RecordSummary();
+
   // Pointer to the heap that owns this tracer.
   Heap* heap_;
 
@@ -390,6 +431,10 @@ class V8_EXPORT_PRIVATE GCTracer {
   // compact event.
   double incremental_marking_duration_;
 
+  // Objects left to the main thread by the concurrent marking tasks since the
+  // end of the last mark-compact event.
+  size_t concurrent_marking_bailouts_;
+
   double incremental_marking_start_time_;
 
   double recorded_incremental_marking_speed_;
@@ -424,6 +469,7 @@ class V8_EXPORT_PRIVATE GCTracer {
   base::RingBuffer<BytesAndDuration> recorded_old_generation_allocations_;
   base::RingBuffer<double> recorded_context_disposal_times_;
   base::RingBuffer<double> recorded_survival_ratios_;
+  base::RingBuffer<Summary> recorded_summaries_;
 
   base::Mutex background_counter_mutex_;
   BackgroundCounter background_counter_[BackgroundScope::NUMBER_OF_SCOPES];
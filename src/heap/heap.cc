@@ -4,6 +4,7 @@
 
 #include "src/heap/heap.h"
 
+#include <limits>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -163,6 +164,11 @@ Heap::Heap()
       memory_pressure_level_(MemoryPressureLevel::kNone),
       out_of_memory_callback_(nullptr),
       out_of_memory_callback_data_(nullptr),
+      heap_soft_limit_(0),
+      heap_soft_limit_callback_(nullptr),
+      heap_soft_limit_callback_data_(nullptr),
+      heap_soft_limit_reached_(false),
+      dormant_memory_reduction_pending_(false),
       contexts_disposed_(0),
       number_of_disposed_maps_(0),
       new_space_(nullptr),
@@ -273,7 +279,10 @@ size_t Heap::CommittedOldGenerationMemory() {
 size_t Heap::CommittedMemory() {
   if (!HasBeenSetUp()) return 0;
 
-  return new_space_->CommittedMemory() + CommittedOldGenerationMemory();
+  // Chunks queued in the unmapper are no longer owned by any space but stay
+  // committed until the unmapper tasks release them.
+  return new_space_->CommittedMemory() + CommittedOldGenerationMemory() +
+         memory_allocator()->unmapper()->CommittedBufferedMemory();
 }
 
 
@@ -375,6 +384,10 @@ void Heap::PrintShortHeapStatistics() {
                          " available: %6" PRIuS " KB\n",
                memory_allocator()->Size() / KB,
                memory_allocator()->Available() / KB);
+  PrintIsolate(isolate_,
+               "Unmapper buffering %d chunks of committed: %6" PRIuS " KB\n",
+               memory_allocator()->unmapper()->NumberOfChunks(),
+               memory_allocator()->unmapper()->CommittedBufferedMemory() / KB);
   PrintIsolate(isolate_, "New space,          used: %6" PRIuS
                          " KB"
                          ", available: %6" PRIuS
@@ -730,6 +743,13 @@ inline bool MakePretenureDecision(
     } else {
       site->set_pretenure_decision(AllocationSite::kDontTenure);
     }
+  } else if (current_decision == AllocationSite::kDontTenure &&
+             FLAG_allocation_site_pretenuring_revisit &&
+             ratio >= AllocationSite::kPretenureRatio) {
+    // Objects of the site used to die young but survive now, e.g. because a
+    // cache started to be filled. Both decisions allocate in new space, so
+    // no deoptimization is needed to take the tenure path again.
+    site->set_pretenure_decision(AllocationSite::kMaybeTenure);
   }
   return false;
 }
@@ -741,7 +761,11 @@ inline bool DigestPretenuringFeedback(Isolate* isolate, AllocationSite* site,
   int found_count = site->memento_found_count();
   bool minimum_mementos_created =
       create_count >= AllocationSite::kPretenureMinimumCreated;
-  double ratio = minimum_mementos_created || FLAG_trace_pretenuring_statistics
+  // Sites that have not created any mementos yet report a ratio of 0 so that
+  // the traces never contain NaN or inf, which are not valid JSON.
+  double ratio = create_count > 0 && (minimum_mementos_created ||
+                                      FLAG_trace_pretenuring_statistics ||
+                                      FLAG_trace_pretenuring_json)
                      ? static_cast<double>(found_count) / create_count
                      : 0.0;
   AllocationSite::PretenureDecision current_decision =
@@ -761,6 +785,20 @@ inline bool DigestPretenuringFeedback(Isolate* isolate, AllocationSite* site,
                  site->PretenureDecisionName(site->pretenure_decision()));
   }
 
+  if (FLAG_trace_pretenuring_json) {
+    PrintF(
+        "{ \"isolate\": \"%p\", \"id\": %d, \"type\": \"allocation_site\", "
+        "\"site\": \"%p\", \"created\": %d, \"found\": %d, "
+        "\"ratio\": %f, \"maximum_size_scavenge\": %s, \"from\": \"%s\", "
+        "\"to\": \"%s\", \"deopt\": %s }\n",
+        static_cast<void*>(isolate), isolate->heap()->gc_count(),
+        static_cast<void*>(site), create_count, found_count, ratio,
+        maximum_size_scavenge ? "true" : "false",
+        site->PretenureDecisionName(current_decision),
+        site->PretenureDecisionName(site->pretenure_decision()),
+        deopt ? "true" : "false");
+  }
+
   // Clear feedback calculation fields until the next gc.
   site->set_memento_found_count(0);
   site->set_memento_create_count(0);
@@ -845,6 +883,18 @@ void Heap::ProcessPretenuringFeedback() {
                    tenure_decisions, dont_tenure_decisions);
     }
 
+    if (FLAG_trace_pretenuring_json) {
+      PrintF(
+          "{ \"isolate\": \"%p\", \"id\": %d, \"type\": \"pretenuring\", "
+          "\"deopt_maybe_tenured\": %s, \"visited_sites\": %d, "
+          "\"active_sites\": %d, \"mementos\": %d, \"tenured\": %d, "
+          "\"not_tenured\": %d }\n",
+          static_cast<void*>(isolate()), gc_count(),
+          deopt_maybe_tenured ? "true" : "false", allocation_sites,
+          active_allocation_sites, allocation_mementos_found,
+          tenure_decisions, dont_tenure_decisions);
+    }
+
     global_pretenuring_feedback_.clear();
     global_pretenuring_feedback_.reserve(kInitialFeedbackCapacity);
   }
@@ -1031,6 +1081,7 @@ void Heap::HandleGCRequest() {
 
 void Heap::ScheduleIdleScavengeIfNeeded(int bytes_allocated) {
   scavenge_job_->ScheduleIdleTaskIfNeeded(this, bytes_allocated);
+  scavenge_job_->ScheduleTaskIfNeeded(this);
 }
 
 void Heap::FinalizeIncrementalMarking(GarbageCollectionReason gc_reason) {
@@ -1349,6 +1400,10 @@ bool Heap::CollectGarbage(AllocationSpace space,
     tracer()->Stop(collector);
   }
 
+  if (collector == MARK_COMPACTOR) {
+    CheckHeapSoftLimit();
+  }
+
   if (collector == MARK_COMPACTOR &&
       (gc_callback_flags & (kGCCallbackFlagForced |
                             kGCCallbackFlagCollectAllAvailableGarbage)) != 0) {
@@ -1442,6 +1497,29 @@ void Heap::MoveElements(FixedArray* array, int dst_index, int src_index,
   FIXED_ARRAY_ELEMENTS_WRITE_BARRIER(this, array, dst_index, len);
 }
 
+void Heap::CopyElements(FixedArray* dst_array, FixedArray* src_array,
+                        int dst_index, int src_index, int len,
+                        WriteBarrierMode mode) {
+  DCHECK_NE(dst_array, src_array);
+  if (len == 0) return;
+
+  DCHECK(dst_array->map() != fixed_cow_array_map());
+  DCHECK_LE(dst_index + len, dst_array->length());
+  DCHECK_LE(src_index + len, src_array->length());
+  Object** dst = dst_array->data_start() + dst_index;
+  Object** src = src_array->data_start() + src_index;
+  if (FLAG_concurrent_marking && incremental_marking()->IsMarking()) {
+    for (int i = 0; i < len; i++) {
+      base::AsAtomicPointer::Relaxed_Store(
+          dst + i, base::AsAtomicPointer::Relaxed_Load(src + i));
+    }
+  } else {
+    MemCopy(dst, src, len * kPointerSize);
+  }
+  if (mode == SKIP_WRITE_BARRIER) return;
+  FIXED_ARRAY_ELEMENTS_WRITE_BARRIER(this, dst_array, dst_index, len);
+}
+
 
 #ifdef VERIFY_HEAP
 // Helper class for verifying the string table.
@@ -1840,8 +1918,49 @@ void Heap::MarkCompactPrologue() {
 }
 
 
+size_t Heap::NewSpaceCapacityForOverheadTarget(size_t survived_bytes,
+                                               double scavenge_speed,
+                                               double allocation_throughput,
+                                               double overhead_target,
+                                               size_t current_capacity) {
+  if (scavenge_speed == 0 || allocation_throughput == 0 ||
+      overhead_target <= 0) {
+    return current_capacity;
+  }
+  // A scavenge takes survived_bytes / scavenge_speed milliseconds and happens
+  // every capacity / allocation_throughput milliseconds of mutator time.
+  const double scavenge_time = survived_bytes / scavenge_speed;
+  const double capacity =
+      scavenge_time * allocation_throughput / overhead_target;
+  if (capacity >= static_cast<double>(std::numeric_limits<size_t>::max())) {
+    return std::numeric_limits<size_t>::max();
+  }
+  return static_cast<size_t>(capacity);
+}
+
+void Heap::AdaptNewSpaceSize() {
+  const size_t capacity = new_space_->TotalCapacity();
+  const size_t target = NewSpaceCapacityForOverheadTarget(
+      survived_last_scavenge_,
+      tracer()->ScavengeSpeedInBytesPerMillisecond(kForSurvivedObjects),
+      tracer()->NewSpaceAllocationThroughputInBytesPerMillisecond(),
+      FLAG_scavenge_overhead_target / 100.0, capacity);
+  if (target > capacity) {
+    if (!new_space_->IsAtMaximumCapacity()) {
+      new_space_->GrowTo(target);
+      survived_since_last_expansion_ = 0;
+    }
+  } else if (target < capacity / 2) {
+    // Only shrink on a substantial drop to avoid resizing back and forth for
+    // small fluctuations of the allocation rate.
+    new_space_->ShrinkTo(target);
+  }
+}
+
 void Heap::CheckNewSpaceExpansionCriteria() {
-  if (FLAG_experimental_new_space_growth_heuristic) {
+  if (FLAG_adaptive_new_space_size) {
+    AdaptNewSpaceSize();
+  } else if (FLAG_experimental_new_space_growth_heuristic) {
     if (new_space_->TotalCapacity() < new_space_->MaximumCapacity() &&
         survived_last_scavenge_ * 100 / new_space_->TotalCapacity() >= 10) {
       // Grow the size of new space if there is room to grow, and more than 10%
@@ -1933,17 +2052,45 @@ static bool IsLogging(Isolate* isolate) {
           isolate->heap_profiler()->is_tracking_object_moves());
 }
 
-class PageScavengingItem final : public ItemParallelJob::Item {
+class ScavengingItem : public ItemParallelJob::Item {
+ public:
+  virtual ~ScavengingItem() {}
+  virtual void Process(Scavenger* scavenger) = 0;
+};
+
+class PageScavengingItem final : public ScavengingItem {
  public:
   explicit PageScavengingItem(MemoryChunk* chunk) : chunk_(chunk) {}
   virtual ~PageScavengingItem() {}
 
-  void Process(Scavenger* scavenger) { scavenger->ScavengePage(chunk_); }
+  void Process(Scavenger* scavenger) final {
+    scavenger->ScavengePage(chunk_);
+  }
 
  private:
   MemoryChunk* const chunk_;
 };
 
+// Scavenges the objects referenced by strong and active weak global handles in
+// a range of the new space nodes.
+class GlobalHandlesScavengingItem final : public ScavengingItem {
+ public:
+  GlobalHandlesScavengingItem(Heap* heap, size_t start, size_t end)
+      : heap_(heap), start_(start), end_(end) {}
+  virtual ~GlobalHandlesScavengingItem() {}
+
+  void Process(Scavenger* scavenger) final {
+    RootScavengeVisitor visitor(heap_, scavenger);
+    heap_->isolate()->global_handles()->IterateNewSpaceStrongAndDependentRoots(
+        &visitor, start_, end_);
+  }
+
+ private:
+  Heap* const heap_;
+  const size_t start_;
+  const size_t end_;
+};
+
 class ScavengingTask final : public ItemParallelJob::Task {
  public:
   ScavengingTask(Heap* heap, Scavenger* scavenger, OneshotBarrier* barrier)
@@ -1960,8 +2107,8 @@ class ScavengingTask final : public ItemParallelJob::Task {
     {
       barrier_->Start();
       TimedScope scope(&scavenging_time);
-      PageScavengingItem* item = nullptr;
-      while ((item = GetItem<PageScavengingItem>()) != nullptr) {
+      ScavengingItem* item = nullptr;
+      while ((item = GetItem<ScavengingItem>()) != nullptr) {
         item->Process(scavenger_);
         item->MarkFinished();
       }
@@ -2052,6 +2199,18 @@ void Heap::Scavenge() {
         this, [&job](MemoryChunk* chunk) {
           job.AddItem(new PageScavengingItem(chunk));
         });
+    if (FLAG_parallel_scavenge_global_handles) {
+      // Create batches of global handles.
+      const size_t kGlobalHandlesBatchSize = 1000;
+      const size_t new_space_nodes =
+          isolate()->global_handles()->NumberOfNewSpaceNodes();
+      for (size_t start = 0; start < new_space_nodes;
+           start += kGlobalHandlesBatchSize) {
+        const size_t end =
+            Min(start + kGlobalHandlesBatchSize, new_space_nodes);
+        job.AddItem(new GlobalHandlesScavengingItem(this, start, end));
+      }
+    }
 
     RootScavengeVisitor root_scavenge_visitor(this, scavengers[kMainThreadId]);
 
@@ -2066,7 +2225,10 @@ void Heap::Scavenge() {
     {
       // Copy roots.
       TRACE_GC(tracer(), GCTracer::Scope::SCAVENGER_SCAVENGE_ROOTS);
-      IterateRoots(&root_scavenge_visitor, VISIT_ALL_IN_SCAVENGE);
+      IterateRoots(&root_scavenge_visitor,
+                   FLAG_parallel_scavenge_global_handles
+                       ? VISIT_ALL_IN_SCAVENGE_EXCEPT_GLOBAL_HANDLES
+                       : VISIT_ALL_IN_SCAVENGE);
     }
     {
       // Weak collections are held strongly by the Scavenger.
@@ -4278,7 +4440,7 @@ bool Heap::HasHighFragmentation(size_t used, size_t committed) {
 
 bool Heap::ShouldOptimizeForMemoryUsage() {
   return FLAG_optimize_for_size || isolate()->IsIsolateInBackground() ||
-         HighMemoryPressure();
+         HighMemoryPressure() || HeapSoftLimitReached();
 }
 
 void Heap::ActivateMemoryReducerIfNeeded() {
@@ -4296,6 +4458,55 @@ void Heap::ActivateMemoryReducerIfNeeded() {
   }
 }
 
+class DormantMemoryReductionTask : public CancelableTask {
+ public:
+  explicit DormantMemoryReductionTask(Heap* heap)
+      : CancelableTask(heap->isolate()), heap_(heap) {}
+
+  virtual ~DormantMemoryReductionTask() {}
+
+ private:
+  // v8::internal::CancelableTask overrides.
+  void RunInternal() override { heap_->ReduceMemoryForDormantIsolate(); }
+
+  Heap* heap_;
+  DISALLOW_COPY_AND_ASSIGN(DormantMemoryReductionTask);
+};
+
+void Heap::ScheduleDormantMemoryReduction() {
+  if (!FLAG_reduce_memory_when_dormant || dormant_memory_reduction_pending_ ||
+      IsTearingDown()) {
+    return;
+  }
+  dormant_memory_reduction_pending_ = true;
+  V8::GetCurrentPlatform()->CallDelayedOnForegroundThread(
+      reinterpret_cast<v8::Isolate*>(isolate()),
+      new DormantMemoryReductionTask(this), FLAG_dormant_isolate_delay);
+}
+
+size_t Heap::ReduceMemoryForDormantIsolate() {
+  dormant_memory_reduction_pending_ = false;
+  // The isolate became active again in the meantime.
+  if (!isolate()->IsIsolateInBackground()) return 0;
+  CollectAllAvailableGarbage(GarbageCollectionReason::kDormantIsolate);
+  mark_compact_collector()->EnsureSweepingCompleted();
+  // Code pages are not writable, so only data pages are discarded.
+  size_t discarded = 0;
+  PagedSpace* spaces[] = {old_space(), map_space()};
+  for (PagedSpace* space : spaces) {
+    space->free_list()->ForAllFreeListCategories(
+        [&discarded](FreeListCategory* category) {
+          discarded += category->DiscardFreeMemory();
+        });
+  }
+  if (FLAG_trace_gc_verbose) {
+    isolate()->PrintWithTimestamp(
+        "Dormant isolate: discarded %" PRIuS " KB of free list memory\n",
+        discarded / KB);
+  }
+  return discarded;
+}
+
 void Heap::ReduceNewSpaceSize() {
   // TODO(ulan): Unify this constant with the similar constant in
   // GCIdleTimeHandler once the change is merged to 4.5.
@@ -4310,6 +4521,9 @@ void Heap::ReduceNewSpaceSize() {
        (allocation_throughput < kLowAllocationThroughput))) {
     new_space_->Shrink();
     UncommitFromSpace();
+    if (ShouldReduceMemory()) {
+      memory_allocator()->unmapper()->ReturnPooledChunksToSharedPool();
+    }
   }
 }
 
@@ -4601,6 +4815,8 @@ void Heap::CheckMemoryPressure() {
   }
   if (memory_pressure_level_.Value() == MemoryPressureLevel::kCritical) {
     CollectGarbageOnMemoryPressure();
+    SharedPagePool::ReleaseAll();
+    array_buffer_collector()->ReleasePool();
   } else if (memory_pressure_level_.Value() == MemoryPressureLevel::kModerate) {
     if (FLAG_incremental_marking && incremental_marking()->IsStopped()) {
       StartIncrementalMarking(kReduceMemoryFootprintMask,
@@ -4627,9 +4843,13 @@ void Heap::CollectGarbageOnMemoryPressure() {
                     kGCCallbackFlagCollectAllAvailableGarbage);
   double end = MonotonicallyIncreasingTimeInMs();
 
-  // Estimate how much memory we can free.
+  // Estimate how much memory we can free. Memory buffered in the unmapper is
+  // released without another GC.
   int64_t potential_garbage =
-      (CommittedMemory() - SizeOfObjects()) + external_memory_;
+      (CommittedMemory() -
+       memory_allocator()->unmapper()->CommittedBufferedMemory() -
+       SizeOfObjects()) +
+      external_memory_;
   // If we can potentially free large amount of memory, then start GC right
   // away instead of waiting for memory reducer.
   if (potential_garbage >= kGarbageThresholdInBytes &&
@@ -4683,6 +4903,61 @@ void Heap::InvokeOutOfMemoryCallback() {
   }
 }
 
+class HeapSoftLimitTask : public CancelableTask {
+ public:
+  explicit HeapSoftLimitTask(Heap* heap)
+      : CancelableTask(heap->isolate()), heap_(heap) {}
+
+  virtual ~HeapSoftLimitTask() {}
+
+ private:
+  // v8::internal::CancelableTask overrides.
+  void RunInternal() override { heap_->InvokeHeapSoftLimitCallback(); }
+
+  Heap* heap_;
+  DISALLOW_COPY_AND_ASSIGN(HeapSoftLimitTask);
+};
+
+void Heap::SetHeapSoftLimit(size_t soft_limit,
+                            v8::HeapSoftLimitCallback callback, void* data) {
+  heap_soft_limit_ = soft_limit;
+  heap_soft_limit_callback_ = callback;
+  heap_soft_limit_callback_data_ = data;
+  heap_soft_limit_reached_ = false;
+}
+
+void Heap::CheckHeapSoftLimit() {
+  if (heap_soft_limit_ == 0) return;
+  const size_t size = SizeOfObjects();
+  if (size <= heap_soft_limit_) {
+    heap_soft_limit_reached_ = false;
+    return;
+  }
+  if (heap_soft_limit_reached_) return;
+  heap_soft_limit_reached_ = true;
+  if (heap_soft_limit_callback_) {
+    V8::GetCurrentPlatform()->CallOnForegroundThread(
+        reinterpret_cast<v8::Isolate*>(isolate()), new HeapSoftLimitTask(this));
+  }
+  // Give the memory reducer a chance to shrink the heap while the embedder
+  // rebalances its memory.
+  if (memory_reducer_ != nullptr) {
+    MemoryReducer::Event event;
+    event.type = MemoryReducer::kPossibleGarbage;
+    event.time_ms = MonotonicallyIncreasingTimeInMs();
+    memory_reducer_->NotifyPossibleGarbage(event);
+  }
+}
+
+void Heap::InvokeHeapSoftLimitCallback() {
+  // The limit may have been removed or the heap may have shrunk since the
+  // task was posted.
+  if (!heap_soft_limit_reached_ || heap_soft_limit_callback_ == nullptr) return;
+  heap_soft_limit_callback_(reinterpret_cast<v8::Isolate*>(isolate()),
+                            SizeOfObjects(), heap_soft_limit_,
+                            heap_soft_limit_callback_data_);
+}
+
 void Heap::CollectCodeStatistics() {
   CodeStatistics::ResetCodeAndMetadataStatistics(isolate());
   // We do not look for code in new space, or map space.  If code
@@ -4757,6 +5032,10 @@ const char* Heap::GarbageCollectionReasonToString(
       return "snapshot creator";
     case GarbageCollectionReason::kTesting:
       return "testing";
+    case GarbageCollectionReason::kTask:
+      return "task";
+    case GarbageCollectionReason::kDormantIsolate:
+      return "dormant isolate";
     case GarbageCollectionReason::kUnknown:
       return "unknown";
   }
@@ -5064,6 +5343,7 @@ void Heap::IterateRoots(RootVisitor* v, VisitMode mode) {
 
 void Heap::IterateWeakRoots(RootVisitor* v, VisitMode mode) {
   const bool isMinorGC = mode == VISIT_ALL_IN_SCAVENGE ||
+                         mode == VISIT_ALL_IN_SCAVENGE_EXCEPT_GLOBAL_HANDLES ||
                          mode == VISIT_ALL_IN_MINOR_MC_MARK ||
                          mode == VISIT_ALL_IN_MINOR_MC_UPDATE;
   v->VisitRootPointer(
@@ -5143,6 +5423,7 @@ class FixStaleLeftTrimmedHandlesVisitor : public RootVisitor {
 
 void Heap::IterateStrongRoots(RootVisitor* v, VisitMode mode) {
   const bool isMinorGC = mode == VISIT_ALL_IN_SCAVENGE ||
+                         mode == VISIT_ALL_IN_SCAVENGE_EXCEPT_GLOBAL_HANDLES ||
                          mode == VISIT_ALL_IN_MINOR_MC_MARK ||
                          mode == VISIT_ALL_IN_MINOR_MC_UPDATE;
   v->VisitRootPointers(Root::kStrongRootList, nullptr, &roots_[0],
@@ -5190,6 +5471,9 @@ void Heap::IterateStrongRoots(RootVisitor* v, VisitMode mode) {
     case VISIT_ALL_IN_SCAVENGE:
       isolate_->global_handles()->IterateNewSpaceStrongAndDependentRoots(v);
       break;
+    case VISIT_ALL_IN_SCAVENGE_EXCEPT_GLOBAL_HANDLES:
+      // Global handles are processed in parallel by the scavenger tasks.
+      break;
     case VISIT_ALL_IN_MINOR_MC_MARK:
       // Global handles are processed manually be the minor MC.
       break;
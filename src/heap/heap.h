@@ -475,7 +475,9 @@ enum class GarbageCollectionReason {
   kRuntime = 18,
   kSamplingProfiler = 19,
   kSnapshotCreator = 20,
-  kTesting = 21
+  kTesting = 21,
+  kTask = 22,
+  kDormantIsolate = 23
   // If you add new items here, then update the incremental_marking_reason,
   // mark_compact_reason, and scavenge_reason counters in counters.h.
   // Also update src/tools/metrics/histograms/histograms.xml in chromium.
@@ -730,6 +732,15 @@ class Heap {
                                                     double mutator_speed,
                                                     double max_factor);
 
+  // Returns the semi-space capacity at which scavenges take the given fraction
+  // of the mutator time, given the number of bytes surviving a scavenge, the
+  // scavenge speed and the new space allocation throughput. Returns
+  // |current_capacity| if the speeds are not known yet.
+  V8_EXPORT_PRIVATE static size_t NewSpaceCapacityForOverheadTarget(
+      size_t survived_bytes, double scavenge_speed,
+      double allocation_throughput, double overhead_target,
+      size_t current_capacity);
+
   // Copy block of memory from src to dst. Size of block should be aligned
   // by pointer size.
   static inline void CopyBlock(Address dst, Address src, int byte_size);
@@ -750,6 +761,13 @@ class Heap {
   // index.
   void MoveElements(FixedArray* array, int dst_index, int src_index, int len);
 
+  // Copy len elements from src_index of src_array to dst_index of dst_array.
+  // The write barrier is applied once for the whole destination range unless
+  // mode is SKIP_WRITE_BARRIER.
+  void CopyElements(FixedArray* dst_array, FixedArray* src_array,
+                    int dst_index, int src_index, int len,
+                    WriteBarrierMode mode);
+
   // Initialize a filler object to keep the ability to iterate over the heap
   // when introducing gaps within pages. If slots could have been recorded in
   // the freed area, then pass ClearRecordedSlots::kYes as the mode. Otherwise,
@@ -872,6 +890,15 @@ class Heap {
   void SetOutOfMemoryCallback(v8::debug::OutOfMemoryCallback callback,
                               void* data);
 
+  void SetHeapSoftLimit(size_t soft_limit, v8::HeapSoftLimitCallback callback,
+                        void* data);
+
+  // Returns true if the last full GC found more live objects than the soft
+  // limit given by the embedder.
+  bool HeapSoftLimitReached() const { return heap_soft_limit_reached_; }
+
+  void InvokeHeapSoftLimitCallback();
+
   double MonotonicallyIncreasingTimeInMs();
 
   void RecordStats(HeapStats* stats, bool take_snapshot = false);
@@ -879,6 +906,14 @@ class Heap {
   // Check new space expansion criteria and expand semispaces if it was hit.
   void CheckNewSpaceExpansionCriteria();
 
+  // Checks the size of live objects against the embedder's soft limit after
+  // a full GC and notifies the embedder when the limit is crossed.
+  void CheckHeapSoftLimit();
+
+  // Resizes the new space towards the capacity that meets
+  // --scavenge-overhead-target.
+  void AdaptNewSpaceSize();
+
   void VisitExternalResources(v8::ExternalResourceVisitor* visitor);
 
   // An object should be promoted if the object has survived a
@@ -934,6 +969,16 @@ class Heap {
 
   void ActivateMemoryReducerIfNeeded();
 
+  // Schedules ReduceMemoryForDormantIsolate() for when the isolate has been
+  // in the background for --dormant-isolate-delay seconds.
+  void ScheduleDormantMemoryReduction();
+
+  // Returns as much memory as possible to the OS: performs a memory reducing
+  // full GC, which also shrinks the new space to its minimum, and discards
+  // the pages covered by free list entries of the remaining pages. Returns the
+  // number of discarded bytes.
+  size_t ReduceMemoryForDormantIsolate();
+
   bool ShouldOptimizeForMemoryUsage();
 
   bool HighMemoryPressure() {
@@ -1428,7 +1473,8 @@ class Heap {
   // Returns the capacity of the old generation.
   size_t OldGenerationCapacity();
 
-  // Returns the amount of memory currently committed for the heap.
+  // Returns the amount of memory currently committed for the heap, including
+  // freed chunks that the unmapper has not released yet.
   size_t CommittedMemory();
 
   // Returns the amount of memory currently committed for the old space.
@@ -2426,6 +2472,14 @@ class Heap {
   v8::debug::OutOfMemoryCallback out_of_memory_callback_;
   void* out_of_memory_callback_data_;
 
+  // Soft limit for the size of live objects set by the embedder, or 0.
+  size_t heap_soft_limit_;
+  v8::HeapSoftLimitCallback heap_soft_limit_callback_;
+  void* heap_soft_limit_callback_data_;
+  bool heap_soft_limit_reached_;
+
+  bool dormant_memory_reduction_pending_;
+
   // For keeping track of context disposals.
   int contexts_disposed_;
 
@@ -730,6 +730,16 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
       *target_fragmentation_percent = kTargetFragmentationPercent;
     }
     *max_evacuated_bytes = kMaxEvacuatedBytes;
+    if (FLAG_compaction_pause_budget_ms > 0 &&
+        estimated_compaction_speed != 0) {
+      // Latency critical embedders can bound the evacuation part of the
+      // atomic pause. Keep at least one area so that compaction can still make
+      // progress on heavily fragmented spaces.
+      const size_t budget_bytes = static_cast<size_t>(
+          FLAG_compaction_pause_budget_ms * estimated_compaction_speed);
+      *max_evacuated_bytes =
+          Max(area_size, Min(*max_evacuated_bytes, budget_bytes));
+    }
   }
 }
 
@@ -953,6 +963,8 @@ void MarkCompactCollector::FinishConcurrentMarking(
     ConcurrentMarking::StopRequest stop_request) {
   if (FLAG_concurrent_marking) {
     heap()->concurrent_marking()->Stop(stop_request);
+    heap()->tracer()->AddConcurrentMarkingBailouts(
+        heap()->concurrent_marking()->TotalBailoutObjects());
     heap()->concurrent_marking()->FlushLiveBytes(non_atomic_marking_state());
   }
 }
@@ -1745,6 +1757,8 @@ void MarkCompactCollector::ProcessMarkingWorklist() {
 
 void MarkCompactCollector::ProcessEphemeralMarking() {
   DCHECK(marking_worklist()->IsEmpty());
+  std::vector<PendingEphemeron> pending;
+  Object* processed_head = Smi::kZero;
   bool work_to_do = true;
   while (work_to_do) {
     if (heap_->local_embedder_heap_tracer()->InUse()) {
@@ -1754,7 +1768,14 @@ void MarkCompactCollector::ProcessEphemeralMarking() {
           0, EmbedderHeapTracer::AdvanceTracingActions(
                  EmbedderHeapTracer::ForceCompletionAction::FORCE_COMPLETION));
     }
-    ProcessWeakCollections();
+    // Only weak collections encountered since the last iteration have to be
+    // scanned completely. For the others it suffices to revisit the entries
+    // whose keys were unmarked, which keeps the fixpoint iteration from
+    // rescanning every entry of every weak collection.
+    Object* head = heap()->encountered_weak_collections();
+    ProcessPendingEphemerons(&pending);
+    ProcessWeakCollections(processed_head, &pending);
+    processed_head = head;
     work_to_do = !marking_worklist()->IsEmpty();
     ProcessMarkingWorklist();
   }
@@ -2737,10 +2758,32 @@ void MarkCompactCollector::TrimEnumCache(Map* map,
 }
 
 
-void MarkCompactCollector::ProcessWeakCollections() {
+template <typename MarkingVisitor>
+void MarkCompactCollector::VisitEphemeron(MarkingVisitor* visitor,
+                                          ObjectHashTable* table, int entry) {
+  Object** key_slot =
+      table->RawFieldOfElementAt(ObjectHashTable::EntryToIndex(entry));
+  DCHECK(
+      non_atomic_marking_state()->IsBlackOrGrey(HeapObject::cast(*key_slot)));
+  RecordSlot(table, key_slot, *key_slot);
+  Object** value_slot =
+      table->RawFieldOfElementAt(ObjectHashTable::EntryToValueIndex(entry));
+  if (V8_UNLIKELY(FLAG_track_retaining_path) &&
+      (*value_slot)->IsHeapObject()) {
+    heap()->AddEphemeralRetainer(HeapObject::cast(*key_slot),
+                                 HeapObject::cast(*value_slot));
+  }
+  visitor->VisitPointer(table, value_slot);
+}
+
+void MarkCompactCollector::ProcessWeakCollections(
+    Object* processed_head, std::vector<PendingEphemeron>* pending) {
   MarkCompactMarkingVisitor visitor(this, marking_state());
+  // Newly encountered weak collections are prepended to the list, so the
+  // collections that have not been scanned yet precede |processed_head|.
   Object* weak_collection_obj = heap()->encountered_weak_collections();
-  while (weak_collection_obj != Smi::kZero) {
+  while (weak_collection_obj != processed_head) {
+    DCHECK_NE(Smi::kZero, weak_collection_obj);
     JSWeakCollection* weak_collection =
         reinterpret_cast<JSWeakCollection*>(weak_collection_obj);
     DCHECK(non_atomic_marking_state()->IsBlackOrGrey(weak_collection));
@@ -2749,17 +2792,9 @@ void MarkCompactCollector::ProcessWeakCollections() {
       for (int i = 0; i < table->Capacity(); i++) {
         HeapObject* heap_object = HeapObject::cast(table->KeyAt(i));
         if (non_atomic_marking_state()->IsBlackOrGrey(heap_object)) {
-          Object** key_slot =
-              table->RawFieldOfElementAt(ObjectHashTable::EntryToIndex(i));
-          RecordSlot(table, key_slot, *key_slot);
-          Object** value_slot =
-              table->RawFieldOfElementAt(ObjectHashTable::EntryToValueIndex(i));
-          if (V8_UNLIKELY(FLAG_track_retaining_path) &&
-              (*value_slot)->IsHeapObject()) {
-            heap()->AddEphemeralRetainer(heap_object,
-                                         HeapObject::cast(*value_slot));
-          }
-          visitor.VisitPointer(table, value_slot);
+          VisitEphemeron(&visitor, table, i);
+        } else {
+          pending->push_back({table, i});
         }
       }
     }
@@ -2767,6 +2802,24 @@ void MarkCompactCollector::ProcessWeakCollections() {
   }
 }
 
+void MarkCompactCollector::ProcessPendingEphemerons(
+    std::vector<PendingEphemeron>* pending) {
+  MarkCompactMarkingVisitor visitor(this, marking_state());
+  size_t i = 0;
+  while (i < pending->size()) {
+    PendingEphemeron ephemeron = (*pending)[i];
+    HeapObject* key = HeapObject::cast(ephemeron.table->KeyAt(ephemeron.entry));
+    if (non_atomic_marking_state()->IsBlackOrGrey(key)) {
+      VisitEphemeron(&visitor, ephemeron.table, ephemeron.entry);
+      // The order of pending entries does not matter.
+      (*pending)[i] = pending->back();
+      pending->pop_back();
+    } else {
+      i++;
+    }
+  }
+}
+
 
 void MarkCompactCollector::ClearWeakCollections() {
   TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR_WEAK_COLLECTIONS);
@@ -809,10 +809,30 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   void TrimDescriptorArray(Map* map, DescriptorArray* descriptors);
   void TrimEnumCache(Map* map, DescriptorArray* descriptors);
 
+  // An entry of a weak collection whose key was not yet marked when the
+  // collection was last visited.
+  struct PendingEphemeron {
+    ObjectHashTable* table;
+    int entry;
+  };
+
   // Mark all values associated with reachable keys in weak collections
-  // encountered so far.  This might push new object or even new weak maps onto
-  // the marking stack.
-  void ProcessWeakCollections();
+  // encountered since |processed_head| was the head of the list of encountered
+  // weak collections.  This might push new object or even new weak maps onto
+  // the marking stack.  Entries with unreachable keys are appended to
+  // |pending|.
+  void ProcessWeakCollections(Object* processed_head,
+                              std::vector<PendingEphemeron>* pending);
+
+  // Mark the values of entries in |pending| whose keys became reachable and
+  // drop these entries from |pending|.
+  void ProcessPendingEphemerons(std::vector<PendingEphemeron>* pending);
+
+  // Marks the value of the given entry and records the key slot. The key must
+  // be marked.
+  template <typename MarkingVisitor>
+  void VisitEphemeron(MarkingVisitor* visitor, ObjectHashTable* table,
+                      int entry);
 
   // After all reachable objects have been marked those weak map entries
   // with an unreachable key are removed from all encountered weak maps.
@@ -905,6 +925,7 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   friend class FullEvacuator;
   friend class Heap;
   friend class RecordMigratedSlotVisitor;
+  friend class heap::HeapTester;
 };
 
 template <FixedArrayVisitationMode fixed_array_mode,
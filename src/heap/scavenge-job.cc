@@ -46,6 +46,26 @@ void ScavengeJob::IdleTask::RunInternal(double deadline_in_seconds) {
   }
 }
 
+void ScavengeJob::Task::RunInternal() {
+  VMState<GC> state(isolate());
+  TRACE_EVENT_CALL_STATS_SCOPED(isolate(), "v8", "V8.Task");
+  Heap* heap = isolate()->heap();
+
+  job_->task_pending_ = false;
+
+  // The new space may have been collected in the meantime.
+  if (ReachedTaskTriggerLimit(heap->new_space()->Size(),
+                              heap->new_space()->Capacity())) {
+    heap->CollectGarbage(NEW_SPACE, GarbageCollectionReason::kTask);
+  }
+}
+
+bool ScavengeJob::ReachedTaskTriggerLimit(size_t new_space_size,
+                                          size_t new_space_capacity) {
+  double trigger = new_space_capacity * FLAG_scavenge_task_trigger / 100.0;
+  return new_space_capacity > 0 && new_space_size >= trigger;
+}
+
 bool ScavengeJob::ReachedIdleAllocationLimit(
     double scavenge_speed_in_bytes_per_ms, size_t new_space_size,
     size_t new_space_capacity) {
@@ -101,6 +121,18 @@ void ScavengeJob::ScheduleIdleTaskIfNeeded(Heap* heap, int bytes_allocated) {
   }
 }
 
+void ScavengeJob::ScheduleTaskIfNeeded(Heap* heap) {
+  if (!FLAG_scavenge_task || task_pending_ || heap->IsTearingDown()) return;
+  if (!ReachedTaskTriggerLimit(heap->new_space()->Size(),
+                               heap->new_space()->Capacity())) {
+    return;
+  }
+  v8::Isolate* isolate = reinterpret_cast<v8::Isolate*>(heap->isolate());
+  task_pending_ = true;
+  auto task = new Task(heap->isolate(), this);
+  V8::GetCurrentPlatform()->CallOnForegroundThread(isolate, task);
+}
+
 
 void ScavengeJob::ScheduleIdleTask(Heap* heap) {
   if (!idle_task_pending_ && !heap->IsTearingDown()) {
@@ -15,8 +15,25 @@ class Heap;
 class Isolate;
 
 // This class posts idle tasks and performs scavenges in the idle tasks.
+// With --scavenge-task it additionally posts a regular foreground task once
+// new space occupancy passes --scavenge-task-trigger, so that the young
+// generation GC runs from the event loop instead of on allocation failure.
 class V8_EXPORT_PRIVATE ScavengeJob {
  public:
+  class Task : public CancelableTask {
+   public:
+    explicit Task(Isolate* isolate, ScavengeJob* job)
+        : CancelableTask(isolate), isolate_(isolate), job_(job) {}
+    // CancelableTask overrides.
+    void RunInternal() override;
+
+    Isolate* isolate() { return isolate_; }
+
+   private:
+    Isolate* isolate_;
+    ScavengeJob* job_;
+  };
+
   class IdleTask : public CancelableIdleTask {
    public:
     explicit IdleTask(Isolate* isolate, ScavengeJob* job)
@@ -34,6 +51,7 @@ class V8_EXPORT_PRIVATE ScavengeJob {
   ScavengeJob()
       : idle_task_pending_(false),
         idle_task_rescheduled_(false),
+        task_pending_(false),
         bytes_allocated_since_the_last_task_(0) {}
 
   // Posts an idle task if the cumulative bytes allocated since the last
@@ -49,6 +67,15 @@ class V8_EXPORT_PRIVATE ScavengeJob {
   void NotifyIdleTask() { idle_task_pending_ = false; }
   bool IdleTaskRescheduled() { return idle_task_rescheduled_; }
 
+  // Posts a regular task if --scavenge-task is enabled and new space
+  // occupancy reached the task trigger.
+  void ScheduleTaskIfNeeded(Heap* heap);
+
+  bool TaskPending() { return task_pending_; }
+
+  static bool ReachedTaskTriggerLimit(size_t new_space_size,
+                                      size_t new_space_capacity);
+
   static bool ReachedIdleAllocationLimit(double scavenge_speed_in_bytes_per_ms,
                                          size_t new_space_size,
                                          size_t new_space_capacity);
@@ -74,6 +101,7 @@ class V8_EXPORT_PRIVATE ScavengeJob {
   void ScheduleIdleTask(Heap* heap);
   bool idle_task_pending_;
   bool idle_task_rescheduled_;
+  bool task_pending_;
   int bytes_allocated_since_the_last_task_;
 };
 }  // namespace internal
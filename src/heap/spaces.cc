@@ -119,12 +119,16 @@ bool CodeRange::SetUp(size_t requested) {
 
   DCHECK(!kRequiresCodeRange || requested <= kMaximalCodeRangeSize);
 
+  size_t alignment = Max(kCodeRangeAreaAlignment, AllocatePageSize());
+  if (FLAG_huge_pages) alignment = Max(alignment, kHugePageSize);
   VirtualMemory reservation;
-  if (!AlignedAllocVirtualMemory(
-          requested, Max(kCodeRangeAreaAlignment, AllocatePageSize()),
-          GetRandomMmapAddr(), &reservation)) {
+  if (!AlignedAllocVirtualMemory(requested, alignment, GetRandomMmapAddr(),
+                                 &reservation)) {
     return false;
   }
+  if (FLAG_huge_pages) {
+    AdviseHugePages(reservation.address(), reservation.size());
+  }
 
   // We are sure that we have mapped a block of requested addresses.
   DCHECK_GE(reservation.size(), requested);
@@ -281,6 +285,7 @@ MemoryAllocator::MemoryAllocator(Isolate* isolate)
       size_executable_(0),
       lowest_ever_allocated_(reinterpret_cast<void*>(-1)),
       highest_ever_allocated_(reinterpret_cast<void*>(0)),
+      huge_page_hint_(nullptr),
       unmapper_(isolate->heap(), this) {}
 
 bool MemoryAllocator::SetUp(size_t capacity, size_t code_range_size) {
@@ -413,7 +418,9 @@ void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedChunks() {
     // to the pooled list. In case of kReleasePooled we need to free them
     // though.
     while ((chunk = GetMemoryChunkSafe<kPooled>()) != nullptr) {
-      allocator_->Free<MemoryAllocator::kAlreadyPooled>(chunk);
+      if (!SharedPagePool::TryAdd(chunk->address())) {
+        allocator_->Free<MemoryAllocator::kAlreadyPooled>(chunk);
+      }
     }
   }
   // Non-regular chunks.
@@ -422,6 +429,17 @@ void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedChunks() {
   }
 }
 
+void MemoryAllocator::Unmapper::ReturnPooledChunksToSharedPool() {
+  if (!FLAG_shared_page_pool) return;
+  MemoryChunk* chunk = nullptr;
+  while ((chunk = GetMemoryChunkSafe<kPooled>()) != nullptr) {
+    if (!SharedPagePool::TryAdd(chunk->address())) {
+      AddMemoryChunkSafe<kPooled>(chunk);
+      break;
+    }
+  }
+}
+
 void MemoryAllocator::Unmapper::TearDown() {
   CHECK_EQ(0, pending_unmapping_tasks_);
   PerformFreeMemoryOnQueuedChunks<FreeMode::kReleasePooled>();
@@ -439,6 +457,64 @@ int MemoryAllocator::Unmapper::NumberOfChunks() {
   return static_cast<int>(result);
 }
 
+size_t MemoryAllocator::Unmapper::CommittedBufferedMemory() {
+  base::LockGuard<base::Mutex> guard(&mutex_);
+
+  size_t sum = 0;
+  // kPooled chunks are already uncommited. We only have to account for
+  // kRegular and kNonRegular chunks.
+  for (auto& chunk : chunks_[kRegular]) {
+    sum += chunk->size();
+  }
+  for (auto& chunk : chunks_[kNonRegular]) {
+    sum += chunk->size();
+  }
+  return sum;
+}
+
+base::LazyMutex SharedPagePool::mutex_ = LAZY_MUTEX_INITIALIZER;
+base::LazyInstance<std::vector<Address>>::type SharedPagePool::chunks_ =
+    LAZY_INSTANCE_INITIALIZER;
+
+bool SharedPagePool::TryAdd(Address chunk) {
+  if (!FLAG_shared_page_pool) return false;
+  DCHECK(
+      IsAligned(reinterpret_cast<uintptr_t>(chunk), MemoryChunk::kAlignment));
+  base::LockGuard<base::Mutex> guard(mutex_.Pointer());
+  if (chunks_.Pointer()->size() >=
+      static_cast<size_t>(FLAG_shared_page_pool_max_pages)) {
+    return false;
+  }
+  chunks_.Pointer()->push_back(chunk);
+  return true;
+}
+
+Address SharedPagePool::TryGet() {
+  if (!FLAG_shared_page_pool) return nullptr;
+  base::LockGuard<base::Mutex> guard(mutex_.Pointer());
+  std::vector<Address>* chunks = chunks_.Pointer();
+  if (chunks->empty()) return nullptr;
+  Address chunk = chunks->back();
+  chunks->pop_back();
+  return chunk;
+}
+
+void SharedPagePool::ReleaseAll() {
+  std::vector<Address> chunks;
+  {
+    base::LockGuard<base::Mutex> guard(mutex_.Pointer());
+    chunks.swap(*chunks_.Pointer());
+  }
+  for (Address chunk : chunks) {
+    CHECK(FreePages(chunk, MemoryChunk::kPageSize));
+  }
+}
+
+size_t SharedPagePool::NumberOfChunks() {
+  base::LockGuard<base::Mutex> guard(mutex_.Pointer());
+  return chunks_.Pointer()->size();
+}
+
 bool MemoryAllocator::CommitMemory(Address base, size_t size,
                                    Executability executable) {
   if (!SetPermissions(base, size, PageAllocator::kReadWrite)) {
@@ -781,6 +857,20 @@ void MemoryChunk::Unlink() {
   set_next_chunk(nullptr);
 }
 
+bool MemoryAllocator::UseHugePages(Executability executable,
+                                   Space* owner) const {
+  if (!FLAG_huge_pages || executable == EXECUTABLE || owner == nullptr) {
+    return false;
+  }
+  return owner->identity() == OLD_SPACE || owner->identity() == MAP_SPACE;
+}
+
+void* MemoryAllocator::HugePageAddressHint() {
+  void* hint = huge_page_hint_.Value();
+  if (hint != nullptr) return hint;
+  return AlignedAddress(isolate_->heap()->GetRandomMmapAddr(), kHugePageSize);
+}
+
 MemoryChunk* MemoryAllocator::AllocateChunk(size_t reserve_area_size,
                                             size_t commit_area_size,
                                             Executability executable,
@@ -793,8 +883,11 @@ MemoryChunk* MemoryAllocator::AllocateChunk(size_t reserve_area_size,
   VirtualMemory reservation;
   Address area_start = nullptr;
   Address area_end = nullptr;
+  const bool use_huge_pages = UseHugePages(executable, owner);
   void* address_hint =
-      AlignedAddress(heap->GetRandomMmapAddr(), MemoryChunk::kAlignment);
+      use_huge_pages
+          ? HugePageAddressHint()
+          : AlignedAddress(heap->GetRandomMmapAddr(), MemoryChunk::kAlignment);
 
   //
   // MemoryChunk layout:
@@ -878,6 +971,13 @@ MemoryChunk* MemoryAllocator::AllocateChunk(size_t reserve_area_size,
 
     if (base == nullptr) return nullptr;
 
+    if (use_huge_pages) {
+      AdviseHugePages(base, chunk_size);
+      // Place the next chunk right after this one so that the kernel merges
+      // the reservations and can back aligned ranges with huge pages.
+      huge_page_hint_.SetValue(base + reservation.size());
+    }
+
     if (Heap::ShouldZapGarbage()) {
       ZapBlock(base, Page::kObjectStartOffset + commit_area_size);
     }
@@ -1164,6 +1264,8 @@ MemoryChunk* MemoryAllocator::AllocatePagePooled(SpaceType* owner) {
   MemoryChunk::Initialize(isolate_->heap(), start, size, area_start, area_end,
                           NOT_EXECUTABLE, owner, &reservation);
   size_.Increment(size);
+  // The chunk may have been reserved by another isolate.
+  UpdateAllocatedSpaceLimits(start, area_end);
   return chunk;
 }
 
@@ -2043,9 +2145,13 @@ void NewSpace::Flip() { SemiSpace::Swap(&from_space_, &to_space_); }
 void NewSpace::Grow() {
   // Double the semispace size but only up to maximum capacity.
   DCHECK(TotalCapacity() < MaximumCapacity());
-  size_t new_capacity =
-      Min(MaximumCapacity(),
-          static_cast<size_t>(FLAG_semi_space_growth_factor) * TotalCapacity());
+  GrowTo(static_cast<size_t>(FLAG_semi_space_growth_factor) * TotalCapacity());
+}
+
+void NewSpace::GrowTo(size_t new_capacity) {
+  new_capacity =
+      Min(MaximumCapacity(), ::RoundUp(new_capacity, Page::kPageSize));
+  if (new_capacity <= TotalCapacity()) return;
   if (to_space_.GrowTo(new_capacity)) {
     // Only grow from space if we managed to grow to-space.
     if (!from_space_.GrowTo(new_capacity)) {
@@ -2062,8 +2168,10 @@ void NewSpace::Grow() {
 }
 
 
-void NewSpace::Shrink() {
-  size_t new_capacity = Max(InitialTotalCapacity(), 2 * Size());
+void NewSpace::Shrink() { ShrinkTo(InitialTotalCapacity()); }
+
+void NewSpace::ShrinkTo(size_t new_capacity) {
+  new_capacity = Max(new_capacity, Max(InitialTotalCapacity(), 2 * Size()));
   size_t rounded_new_capacity = ::RoundUp(new_capacity, Page::kPageSize);
   if (rounded_new_capacity < TotalCapacity() &&
       to_space_.ShrinkTo(rounded_new_capacity)) {
@@ -2761,6 +2869,27 @@ FreeSpace* FreeListCategory::SearchForNodeInList(size_t minimum_size,
   return nullptr;
 }
 
+size_t FreeListCategory::DiscardFreeMemory() {
+  DCHECK_NE(CODE_SPACE, page()->owner()->identity());
+  const size_t commit_page_size = MemoryAllocator::GetCommitPageSize();
+  size_t discarded = 0;
+  for (FreeSpace* cur_node = top(); cur_node != nullptr;
+       cur_node = cur_node->next()) {
+    // Keep the page holding the free space header, which links the list.
+    Address start =
+        ::RoundUp(cur_node->address() + FreeSpace::kSize, commit_page_size);
+    Address end =
+        ::RoundDown(cur_node->address() + cur_node->size(), commit_page_size);
+    if (start >= end) continue;
+    size_t size = static_cast<size_t>(end - start);
+    // Dropping access lets the OS reclaim the pages, see SetPermissions.
+    CHECK(SetPermissions(start, size, PageAllocator::kNoAccess));
+    CHECK(SetPermissions(start, size, PageAllocator::kReadWrite));
+    discarded += size;
+  }
+  return discarded;
+}
+
 void FreeListCategory::Free(Address start, size_t size_in_bytes,
                             FreeMode mode) {
   DCHECK(page()->CanAllocate());
@@ -2875,9 +3004,34 @@ FreeSpace* FreeList::SearchForNodeInList(FreeListCategoryType type,
   return node;
 }
 
+FreeSpace* FreeList::ProbeSizeClass(FreeListCategoryType type,
+                                    size_t minimum_size, size_t* node_size) {
+  FreeListCategoryIterator it(this, type);
+  for (int probes = 0; probes < kMaxSizeClassProbes && it.HasNext();
+       probes++) {
+    FreeSpace* node = it.Next()->PickNodeFromList(minimum_size, node_size);
+    if (node != nullptr) {
+      DCHECK(IsVeryLong() || Available() == SumFreeLists());
+      return node;
+    }
+  }
+  return nullptr;
+}
+
 FreeSpace* FreeList::Allocate(size_t size_in_bytes, size_t* node_size) {
   DCHECK_GE(kMaxBlockSize, size_in_bytes);
   FreeSpace* node = nullptr;
+  if (FLAG_size_class_allocation && size_in_bytes <= kTinyListMax) {
+    // The fast path below never looks at the tiny categories, so holes left
+    // by small objects would only be reused after larger entries have been
+    // split up. Refill small requests from their own size class first.
+    node = ProbeSizeClass(SelectFreeListCategoryType(size_in_bytes),
+                          size_in_bytes, node_size);
+    if (node != nullptr) {
+      Page::FromAddress(node->address())->IncreaseAllocatedBytes(*node_size);
+      return node;
+    }
+  }
   // First try the allocation fast path: try to allocate the minimum element
   // size of a free list category. This operation is constant time.
   FreeListCategoryType type =
@@ -188,6 +188,11 @@ class FreeListCategory {
   // actual size in |node_size|. Returns nullptr if no node is found.
   FreeSpace* SearchForNodeInList(size_t minimum_size, size_t* node_size);
 
+  // Returns the OS pages that lie entirely inside free list entries to the
+  // OS. The entries themselves stay intact. Returns the number of discarded
+  // bytes.
+  size_t DiscardFreeMemory();
+
   inline FreeList* owner();
   inline Page* page() const { return page_; }
   inline bool is_linked();
@@ -1161,6 +1166,32 @@ class SkipList {
 };
 
 
+// ----------------------------------------------------------------------------
+// Process-wide pool of uncommitted, page-sized and page-aligned reservations.
+// Isolates hand their pooled chunks to it on tear down and when they reduce
+// memory instead of unmapping them, and draw from it when their own pool is
+// empty. This lets allocation bursts in one isolate reuse address space
+// another isolate has released without going through mmap/munmap. Enabled by
+// --shared-page-pool and bounded by --shared-page-pool-max-pages.
+class V8_EXPORT_PRIVATE SharedPagePool : public AllStatic {
+ public:
+  // Takes ownership of the uncommitted chunk at |chunk|. Returns false if the
+  // pool is disabled or full, in which case the caller still owns the chunk.
+  static bool TryAdd(Address chunk);
+
+  // Returns an uncommitted chunk of MemoryChunk::kPageSize or nullptr.
+  static Address TryGet();
+
+  // Returns all pooled chunks to the operating system.
+  static void ReleaseAll();
+
+  static size_t NumberOfChunks();
+
+ private:
+  static base::LazyMutex mutex_;
+  static base::LazyInstance<std::vector<Address>>::type chunks_;
+};
+
 // ----------------------------------------------------------------------------
 // A space acquires chunks of memory from the operating system. The memory
 // allocator allocates and deallocates pages for the paged heap spaces and large
@@ -1197,6 +1228,7 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
       // been uncommitted.
       // (2) Try to steal any memory chunk of kPageSize that would've been
       // unmapped.
+      // (3) Try to get an uncommitted chunk from the process-wide pool.
       MemoryChunk* chunk = GetMemoryChunkSafe<kPooled>();
       if (chunk == nullptr) {
         chunk = GetMemoryChunkSafe<kRegular>();
@@ -1205,13 +1237,22 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
           chunk->ReleaseAllocatedMemory();
         }
       }
+      if (chunk == nullptr) {
+        chunk = reinterpret_cast<MemoryChunk*>(SharedPagePool::TryGet());
+      }
       return chunk;
     }
 
+    // Moves already uncommitted pooled chunks to the SharedPagePool.
+    void ReturnPooledChunksToSharedPool();
+
     void FreeQueuedChunks();
     void WaitUntilCompleted();
     void TearDown();
     int NumberOfChunks();
+    // Returns the number of bytes of queued chunks that are still committed,
+    // i.e., memory that was freed by the GC but not yet released to the OS.
+    size_t CommittedBufferedMemory();
 
    private:
     static const int kReservedQueueingSlots = 64;
@@ -1412,6 +1453,14 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
   Page* InitializePagesInChunk(int chunk_id, int pages_in_chunk,
                                PagedSpace* owner);
 
+  // Returns true if chunks for |owner| should be placed in huge page backed
+  // regions (--huge-pages).
+  bool UseHugePages(Executability executable, Space* owner) const;
+
+  // Returns the address right after the last huge page backed chunk, or a
+  // random huge page aligned address for the first one.
+  void* HugePageAddressHint();
+
   void UpdateAllocatedSpaceLimits(void* low, void* high) {
     // The use of atomic primitives does not guarantee correctness (wrt.
     // desired semantics) by default. The loop here ensures that we update the
@@ -1455,6 +1504,9 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
   base::AtomicValue<void*> lowest_ever_allocated_;
   base::AtomicValue<void*> highest_ever_allocated_;
 
+  // Hint for the next huge page backed chunk with --huge-pages.
+  base::AtomicValue<void*> huge_page_hint_;
+
   VirtualMemory last_chunk_;
   Unmapper unmapper_;
 
@@ -1873,6 +1925,10 @@ class V8_EXPORT_PRIVATE FreeList {
   static const size_t kMediumAllocationMax = kSmallListMax;
   static const size_t kLargeAllocationMax = kMediumListMax;
 
+  // Number of pages probed for an entry of the requested size class by
+  // --size-class-allocation.
+  static const int kMaxSizeClassProbes = 8;
+
   // Walks all available categories for a given |type| and tries to retrieve
   // a node. Returns nullptr if the category is empty.
   FreeSpace* FindNodeIn(FreeListCategoryType type, size_t minimum_size,
@@ -1888,6 +1944,11 @@ class V8_EXPORT_PRIVATE FreeList {
   FreeSpace* SearchForNodeInList(FreeListCategoryType type, size_t* node_size,
                                  size_t minimum_size);
 
+  // Tries the top entries of the first kMaxSizeClassProbes categories of a
+  // given |type|. Unlike FindNodeIn, categories are left linked on failure.
+  FreeSpace* ProbeSizeClass(FreeListCategoryType type, size_t minimum_size,
+                            size_t* node_size);
+
   // The tiny categories are not used for fast allocation.
   FreeListCategoryType SelectFastAllocationFreeListCategoryType(
       size_t size_in_bytes) {
@@ -2566,9 +2627,17 @@ class NewSpace : public SpaceWithLinearArea {
   // their maximum capacity.
   void Grow();
 
+  // Grow the capacity of the semispaces to |new_capacity|, capped at their
+  // maximum capacity.
+  void GrowTo(size_t new_capacity);
+
   // Shrink the capacity of the semispaces.
   void Shrink();
 
+  // Shrink the capacity of the semispaces to |new_capacity|, but not below
+  // their initial capacity or twice the size of the live objects.
+  void ShrinkTo(size_t new_capacity);
+
   // Return the allocated bytes in the active semispace.
   size_t Size() override {
     DCHECK_GE(top(), to_space_.page_low());
@@ -104,6 +104,10 @@ void StoreBuffer::MoveEntriesToRememberedSet(int index) {
   DCHECK_GE(index, 0);
   DCHECK_LT(index, kStoreBuffers);
   Address last_inserted_addr = nullptr;
+  // Write-heavy code tends to produce runs of slots on the same chunk. Cache
+  // the last chunk to avoid the page lookup, which may have to consult the
+  // large object chunk map, for every entry.
+  MemoryChunk* chunk = nullptr;
 
   // We are taking the chunk map mutex here because the page lookup of addr
   // below may require us to check if addr is part of a large page.
@@ -111,13 +115,16 @@ void StoreBuffer::MoveEntriesToRememberedSet(int index) {
   for (Address* current = start_[index]; current < lazy_top_[index];
        current++) {
     Address addr = *current;
-    MemoryChunk* chunk = MemoryChunk::FromAnyPointerAddress(heap_, addr);
+    Address slot = UnmarkDeletionAddress(addr);
+    if (chunk == nullptr || !chunk->Contains(slot)) {
+      chunk = MemoryChunk::FromAnyPointerAddress(heap_, slot);
+    }
     if (IsDeletionAddress(addr)) {
       last_inserted_addr = nullptr;
       current++;
       Address end = *current;
       DCHECK(!IsDeletionAddress(end));
-      addr = UnmarkDeletionAddress(addr);
+      addr = slot;
       if (end) {
         RememberedSet<OLD_TO_NEW>::RemoveRange(chunk, addr, end,
                                                SlotSet::PREFREE_EMPTY_BUCKETS);
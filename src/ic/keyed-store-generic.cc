@@ -492,8 +492,33 @@ void KeyedStoreGenericAssembler::EmitGenericElementStore(
   BIND(&if_grow);
   {
     Comment("Grow backing store");
-    // TODO(jkummerow): Support inline backing store growth.
-    Goto(slow);
+    // Appending a single element to a JSArray grows the backing store inline.
+    // Stores that would leave a gap go to the runtime.
+    GotoIfNot(InstanceTypeEqual(instance_type, JS_ARRAY_TYPE), slow);
+    Node* length = SmiUntag(LoadFastJSArrayLength(receiver));
+    GotoIfNot(WordEqual(intptr_index, length), slow);
+    Node* smi_index = SmiTag(intptr_index);
+
+    Label if_double(this), if_grown(this);
+    VARIABLE(var_elements, MachineRepresentation::kTagged);
+    STATIC_ASSERT(PACKED_DOUBLE_ELEMENTS + 1 == HOLEY_DOUBLE_ELEMENTS);
+    STATIC_ASSERT(HOLEY_DOUBLE_ELEMENTS == LAST_FAST_ELEMENTS_KIND);
+    GotoIf(Int32GreaterThanOrEqual(elements_kind,
+                                   Int32Constant(PACKED_DOUBLE_ELEMENTS)),
+           &if_double);
+    var_elements.Bind(TryGrowElementsCapacity(receiver, elements,
+                                              HOLEY_ELEMENTS, smi_index, slow));
+    Goto(&if_grown);
+
+    BIND(&if_double);
+    var_elements.Bind(TryGrowElementsCapacity(
+        receiver, elements, HOLEY_DOUBLE_ELEMENTS, smi_index, slow));
+    Goto(&if_grown);
+
+    BIND(&if_grown);
+    StoreElementWithCapacity(receiver, receiver_map, var_elements.value(),
+                             elements_kind, intptr_index, value, context, slow,
+                             kIncrementLengthByOne);
   }
 
   // Any ElementsKind > LAST_FAST_ELEMENTS_KIND jumps here for further
@@ -520,8 +545,45 @@ void KeyedStoreGenericAssembler::EmitGenericElementStore(
   BIND(&if_typed_array);
   {
     Comment("Typed array");
-    // TODO(jkummerow): Support typed arrays.
-    Goto(slow);
+    // Only Smis and HeapNumbers are stored inline, so that the ToNumber
+    // conversion cannot call back into JavaScript. BigInt typed arrays and
+    // out-of-bounds stores are left to the runtime.
+    Label if_number(this);
+    GotoIf(TaggedIsSmi(value), &if_number);
+    Branch(IsHeapNumber(value), &if_number, slow);
+
+    BIND(&if_number);
+    Node* buffer = LoadObjectField(receiver, JSArrayBufferView::kBufferOffset);
+    GotoIf(IsDetachedBuffer(buffer), slow);
+    Node* length =
+        SmiUntag(CAST(LoadObjectField(receiver, JSTypedArray::kLengthOffset)));
+    GotoIfNot(UintPtrLessThan(intptr_index, length), slow);
+
+    Label uint8_elements(this), uint8_clamped_elements(this),
+        int8_elements(this), uint16_elements(this), int16_elements(this),
+        uint32_elements(this), int32_elements(this), float32_elements(this),
+        float64_elements(this);
+    Label* elements_kind_labels[] = {
+        &uint8_elements,  &uint8_clamped_elements, &int8_elements,
+        &uint16_elements, &int16_elements,         &uint32_elements,
+        &int32_elements,  &float32_elements,       &float64_elements};
+    int32_t elements_kinds[] = {
+        UINT8_ELEMENTS,  UINT8_CLAMPED_ELEMENTS, INT8_ELEMENTS,
+        UINT16_ELEMENTS, INT16_ELEMENTS,         UINT32_ELEMENTS,
+        INT32_ELEMENTS,  FLOAT32_ELEMENTS,       FLOAT64_ELEMENTS};
+    STATIC_ASSERT(arraysize(elements_kinds) == arraysize(elements_kind_labels));
+    Switch(elements_kind, slow, elements_kinds, elements_kind_labels,
+           arraysize(elements_kinds));
+    for (size_t i = 0; i < arraysize(elements_kinds); i++) {
+      ElementsKind kind = static_cast<ElementsKind>(elements_kinds[i]);
+      BIND(elements_kind_labels[i]);
+      Node* prepared_value =
+          PrepareValueForWriteToTypedArray(CAST(value), kind, CAST(context));
+      Node* backing_store = LoadFixedTypedArrayBackingStore(CAST(elements));
+      StoreElement(backing_store, kind, intptr_index, prepared_value,
+                   INTPTR_PARAMETERS);
+      Return(value);
+    }
   }
 }
 
@@ -1400,6 +1400,39 @@ void BytecodeGenerator::VisitWithStatement(WithStatement* stmt) {
   VisitInScope(stmt->statement(), stmt->scope());
 }
 
+namespace {
+
+// Switches with at least this many Smi case labels, spread over a range of at
+// most kMaxSwitchJumpTableSpread entries per label, dispatch through a jump
+// table.
+const int kMinCasesForSwitchJumpTable = 4;
+const int kMaxSwitchJumpTableSpread = 3;
+
+bool IsDenseSmiSwitch(ZoneList<CaseClause*>* clauses, int* min_case,
+                      int* max_case) {
+  int num_cases = 0;
+  int64_t min = kMaxInt;
+  int64_t max = kMinInt;
+  for (int i = 0; i < clauses->length(); i++) {
+    CaseClause* clause = clauses->at(i);
+    if (clause->is_default()) continue;
+    if (!clause->label()->IsSmiLiteral()) return false;
+    int value = clause->label()->AsLiteral()->AsSmiLiteral()->value();
+    min = std::min<int64_t>(min, value);
+    max = std::max<int64_t>(max, value);
+    num_cases++;
+  }
+  if (num_cases < kMinCasesForSwitchJumpTable) return false;
+  if (max - min + 1 > int64_t{kMaxSwitchJumpTableSpread} * num_cases) {
+    return false;
+  }
+  *min_case = static_cast<int>(min);
+  *max_case = static_cast<int>(max);
+  return true;
+}
+
+}  // namespace
+
 void BytecodeGenerator::VisitSwitchStatement(SwitchStatement* stmt) {
   // We need this scope because we visit for register values. We have to
   // maintain a execution result scope where registers can be allocated.
@@ -1417,6 +1450,19 @@ void BytecodeGenerator::VisitSwitchStatement(SwitchStatement* stmt) {
                           ? feedback_spec()->AddCompareICSlot()
                           : FeedbackSlot::Invalid();
 
+  // Dense switches over Smi labels first dispatch Smi tags through a jump
+  // table. Tags that are not Smis (e.g. heap numbers equal to a label) and
+  // Smis outside of the table fall through to the label comparisons below.
+  BytecodeJumpTable* jump_table = nullptr;
+  int min_case;
+  int max_case;
+  if (IsDenseSmiSwitch(clauses, &min_case, &max_case)) {
+    jump_table =
+        builder()->AllocateJumpTable(max_case - min_case + 1, min_case);
+    builder()->LoadAccumulatorWithRegister(tag).SwitchOnSmiNoFeedback(
+        jump_table);
+  }
+
   // Iterate over all cases and create nodes for label comparison.
   for (int i = 0; i < clauses->length(); i++) {
     CaseClause* clause = clauses->at(i);
@@ -1446,9 +1492,39 @@ void BytecodeGenerator::VisitSwitchStatement(SwitchStatement* stmt) {
   // Iterate over all cases and create the case bodies.
   for (int i = 0; i < clauses->length(); i++) {
     CaseClause* clause = clauses->at(i);
+    if (jump_table != nullptr) {
+      if (clause->is_default()) {
+        BindSwitchJumpTableHoles(jump_table, clauses);
+      } else {
+        // Only the first of several clauses with the same label can match.
+        int value = clause->label()->AsLiteral()->AsSmiLiteral()->value();
+        if (!jump_table->is_bound(value)) builder()->Bind(jump_table, value);
+      }
+    }
     switch_builder.SetCaseTarget(i, clause);
     VisitStatements(clause->statements());
   }
+
+  // Without a default clause, Smi tags that match no label leave the switch.
+  if (jump_table != nullptr && default_index < 0) {
+    BindSwitchJumpTableHoles(jump_table, clauses);
+  }
+}
+
+void BytecodeGenerator::BindSwitchJumpTableHoles(
+    BytecodeJumpTable* jump_table, ZoneList<CaseClause*>* clauses) {
+  // Entries for case values that have a label are bound at their clause.
+  ZoneVector<bool> has_label(jump_table->size(), false, zone());
+  for (int i = 0; i < clauses->length(); i++) {
+    CaseClause* clause = clauses->at(i);
+    if (clause->is_default()) continue;
+    int value = clause->label()->AsLiteral()->AsSmiLiteral()->value();
+    has_label[value - jump_table->case_value_base()] = true;
+  }
+  for (int i = 0; i < jump_table->size(); i++) {
+    if (has_label[i]) continue;
+    builder()->Bind(jump_table, jump_table->case_value_base() + i);
+  }
 }
 
 void BytecodeGenerator::VisitIterationBody(IterationStatement* stmt,
@@ -220,6 +220,11 @@ class BytecodeGenerator final : public AstVisitor<BytecodeGenerator> {
   // Visit the body of a loop iteration.
   void VisitIterationBody(IterationStatement* stmt, LoopBuilder* loop_builder);
 
+  // Bind the switch jump table entries that have no case label at the current
+  // bytecode offset.
+  void BindSwitchJumpTableHoles(BytecodeJumpTable* jump_table,
+                                ZoneList<CaseClause*>* clauses);
+
   // Visit a statement and switch scopes, the context is in the accumulator.
   void VisitInScope(Statement* stmt, Scope* scope);
 
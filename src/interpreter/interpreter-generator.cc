@@ -2295,8 +2295,8 @@ IGNITION_HANDLER(JumpLoop, InterpreterAssembler) {
 // Jump by the number of bytes defined by a Smi in a table in the constant pool,
 // where the table starts at |table_start| and has |table_length| entries.
 // The table is indexed by the accumulator, minus |case_value_base|. If the
-// case_value falls outside of the table |table_length|, fall-through to the
-// next bytecode.
+// accumulator is not a Smi or the case_value falls outside of the table
+// |table_length|, fall-through to the next bytecode.
 IGNITION_HANDLER(SwitchOnSmiNoFeedback, InterpreterAssembler) {
   Node* acc = GetAccumulator();
   Node* table_start = BytecodeOperandIdx(0);
@@ -2305,10 +2305,9 @@ IGNITION_HANDLER(SwitchOnSmiNoFeedback, InterpreterAssembler) {
 
   Label fall_through(this);
 
-  // The accumulator must be a Smi.
   // TODO(leszeks): Add a bytecode with type feedback that allows other
   // accumulator values.
-  CSA_ASSERT(this, TaggedIsSmi(acc));
+  GotoIfNot(TaggedIsSmi(acc), &fall_through);
 
   Node* case_value = IntPtrSub(SmiUntag(acc), case_value_base);
   GotoIf(IntPtrLessThan(case_value, IntPtrConstant(0)), &fall_through);
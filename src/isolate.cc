@@ -4005,6 +4005,7 @@ void Isolate::SetRAILMode(RAILMode rail_mode) {
 void Isolate::IsolateInBackgroundNotification() {
   is_isolate_in_background_ = true;
   heap()->ActivateMemoryReducerIfNeeded();
+  heap()->ScheduleDormantMemoryReduction();
 }
 
 void Isolate::IsolateInForegroundNotification() {
@@ -2031,10 +2031,31 @@ var defaultObjects = {
   'dateformattime': UNDEFINED,
 };
 
+// Instances created with a single string locale and no options. Only the
+// most recently used locale is kept per service, in localeObjectKeys.
+var localeObjects = {
+  'collator': UNDEFINED,
+  'numberformat': UNDEFINED,
+  'dateformatall': UNDEFINED,
+  'dateformatdate': UNDEFINED,
+  'dateformattime': UNDEFINED,
+};
+
+var localeObjectKeys = {
+  'collator': UNDEFINED,
+  'numberformat': UNDEFINED,
+  'dateformatall': UNDEFINED,
+  'dateformatdate': UNDEFINED,
+  'dateformattime': UNDEFINED,
+};
+
 function clearDefaultObjects() {
   defaultObjects['dateformatall'] = UNDEFINED;
   defaultObjects['dateformatdate'] = UNDEFINED;
   defaultObjects['dateformattime'] = UNDEFINED;
+  localeObjects['dateformatall'] = UNDEFINED;
+  localeObjects['dateformatdate'] = UNDEFINED;
+  localeObjects['dateformattime'] = UNDEFINED;
 }
 
 var date_cache_version = 0;
@@ -2051,16 +2072,29 @@ function checkDateCacheCurrent() {
 
 /**
  * Returns cached or newly created instance of a given service.
- * We cache only default instances (where no locales or options are provided).
+ * We cache only instances created without options, either with no locales
+ * or with a single locale string.
  */
 function cachedOrNewService(service, locales, options, defaults) {
   var useOptions = (IS_UNDEFINED(defaults)) ? options : defaults;
-  if (IS_UNDEFINED(locales) && IS_UNDEFINED(options)) {
-    checkDateCacheCurrent();
-    if (IS_UNDEFINED(defaultObjects[service])) {
-      defaultObjects[service] = new savedObjects[service](locales, useOptions);
+  if (IS_UNDEFINED(options)) {
+    if (IS_UNDEFINED(locales)) {
+      checkDateCacheCurrent();
+      if (IS_UNDEFINED(defaultObjects[service])) {
+        defaultObjects[service] =
+            new savedObjects[service](locales, useOptions);
+      }
+      return defaultObjects[service];
+    }
+    if (IS_STRING(locales)) {
+      checkDateCacheCurrent();
+      if (IS_UNDEFINED(localeObjects[service]) ||
+          localeObjectKeys[service] !== locales) {
+        localeObjects[service] = new savedObjects[service](locales, useOptions);
+        localeObjectKeys[service] = locales;
+      }
+      return localeObjects[service];
     }
-    return defaultObjects[service];
   }
   return new savedObjects[service](locales, useOptions);
 }
@@ -637,17 +637,25 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonNumber() {
     // a decimal point or exponent.
     if (IsDecimalDigit(c0_)) return ReportUnexpectedCharacter();
   } else {
-    int i = 0;
+    // Integers of up to kMaxExactDigits digits are exactly representable as
+    // doubles, so they do not need to go through StringToDouble.
+    static const int kMaxExactDigits = 15;
+    int64_t i = 0;
     int digits = 0;
     if (c0_ < '1' || c0_ > '9') return ReportUnexpectedCharacter();
     do {
-      i = i * 10 + c0_ - '0';
+      if (digits < kMaxExactDigits) i = i * 10 + c0_ - '0';
       digits++;
       Advance();
     } while (IsDecimalDigit(c0_));
-    if (c0_ != '.' && c0_ != 'e' && c0_ != 'E' && digits < 10) {
+    if (c0_ != '.' && c0_ != 'e' && c0_ != 'E' && digits <= kMaxExactDigits) {
       SkipWhitespace();
-      return Handle<Smi>(Smi::FromInt((negative ? -i : i)), isolate());
+      if (digits < 10) {
+        int value = static_cast<int>(i);
+        return Handle<Smi>(Smi::FromInt(negative ? -value : value), isolate());
+      }
+      double value = static_cast<double>(i);
+      return factory()->NewNumber(negative ? -value : value, pretenure_);
     }
   }
   if (c0_ == '.') {
@@ -13,6 +13,9 @@ namespace internal {
 // Cache for mapping (map, property name) into descriptor index.
 // The cache contains both positive and negative results.
 // Descriptor index equals kNotFound means the property is absent.
+// The cache is set-associative: each (map, name) pair hashes to one of
+// kSets sets, and each set holds kWays entries ordered from most to
+// least recently inserted.
 // Cleared at startup and prior to any gc.
 class DescriptorLookupCache {
  public:
@@ -37,9 +40,13 @@ class DescriptorLookupCache {
     }
   }
 
+  // Returns the index of the first entry of the set for (source, name).
   static inline int Hash(Object* source, Name* name);
 
-  static const int kLength = 64;
+  static const int kSetsLog2 = 6;
+  static const int kSets = 1 << kSetsLog2;
+  static const int kWays = 2;
+  static const int kLength = kSets * kWays;
   struct Key {
     Map* source;
     Name* name;
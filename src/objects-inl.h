@@ -1925,8 +1925,11 @@ int DescriptorArray::SearchWithCache(Isolate* isolate, Name* name, Map* map) {
   int number = cache->Lookup(map, name);
 
   if (number == DescriptorLookupCache::kAbsent) {
+    isolate->counters()->descriptor_lookup_cache_misses()->Increment();
     number = Search(name, number_of_own_descriptors);
     cache->Update(map, name, number);
+  } else {
+    isolate->counters()->descriptor_lookup_cache_hits()->Increment();
   }
 
   return number;
@@ -40,6 +40,7 @@
 #include "src/field-type.h"
 #include "src/frames-inl.h"
 #include "src/globals.h"
+#include "src/heap/array-buffer-collector.h"
 #include "src/ic/ic.h"
 #include "src/identity-map.h"
 #include "src/interpreter/bytecode-array-iterator.h"
@@ -19110,12 +19111,20 @@ bool JSArrayBuffer::SetupAllocatingData(Handle<JSArrayBuffer> array_buffer,
     if (shared == SharedFlag::kShared)
       isolate->counters()->shared_array_allocations()->AddSample(
           ConvertToMb(allocated_length));
-    if (initialize) {
-      data = isolate->array_buffer_allocator()->Allocate(allocated_length);
-    } else {
-      data = isolate->array_buffer_allocator()->AllocateUninitialized(
+    data = nullptr;
+    if (FLAG_array_buffer_pool) {
+      // Pooled backing stores are cleared when they are added to the pool.
+      data = isolate->heap()->array_buffer_collector()->TryAllocateFromPool(
           allocated_length);
     }
+    if (data == nullptr) {
+      if (initialize) {
+        data = isolate->array_buffer_allocator()->Allocate(allocated_length);
+      } else {
+        data = isolate->array_buffer_allocator()->AllocateUninitialized(
+            allocated_length);
+      }
+    }
     if (data == nullptr) {
       isolate->counters()->array_buffer_new_size_failures()->AddSample(
           ConvertToMb(allocated_length));
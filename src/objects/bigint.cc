@@ -19,6 +19,9 @@
 
 #include "src/objects/bigint.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "src/double.h"
 #include "src/objects-inl.h"
 
@@ -106,6 +109,21 @@ class MutableBigInt : public FreshlyAllocatedBigInt {
   static void InternalMultiplyAdd(BigIntBase* source, digit_t factor,
                                   digit_t summand, int n,
                                   MutableBigInt* result);
+
+  // Specialized helpers for multiplying large BigInts. These operate on raw
+  // digit arrays so that the recursion does not allocate on the heap.
+  // Operands shorter than this many digits use schoolbook multiplication.
+  static const int kKaratsubaThreshold = 34;
+  static void MultiplyDigits(const digit_t* x, int x_length, const digit_t* y,
+                             int y_length, digit_t* result);
+  static void KaratsubaMultiply(const digit_t* x, int x_length,
+                                const digit_t* y, int y_length,
+                                digit_t* result);
+  static digit_t AddDigits(digit_t* accumulator, int accumulator_length,
+                           const digit_t* summand, int summand_length);
+  static digit_t SubtractDigits(digit_t* accumulator, int accumulator_length,
+                                const digit_t* subtrahend,
+                                int subtrahend_length);
   void InplaceMultiplyAdd(uintptr_t factor, uintptr_t summand);
 
   // Specialized helpers for Divide/Remainder.
@@ -389,9 +407,21 @@ MaybeHandle<BigInt> BigInt::Multiply(Handle<BigInt> x, Handle<BigInt> y) {
   if (!MutableBigInt::New(x->GetIsolate(), result_length).ToHandle(&result)) {
     return MaybeHandle<BigInt>();
   }
-  result->InitializeDigits(result_length);
-  for (int i = 0; i < x->length(); i++) {
-    MutableBigInt::MultiplyAccumulate(y, x->digit(i), result, i);
+  if (Min(x->length(), y->length()) >= MutableBigInt::kKaratsubaThreshold) {
+    std::vector<digit_t> x_digits(x->length());
+    std::vector<digit_t> y_digits(y->length());
+    std::vector<digit_t> product(result_length);
+    for (int i = 0; i < x->length(); i++) x_digits[i] = x->digit(i);
+    for (int i = 0; i < y->length(); i++) y_digits[i] = y->digit(i);
+    MutableBigInt::MultiplyDigits(x_digits.data(), x->length(),
+                                  y_digits.data(), y->length(),
+                                  product.data());
+    for (int i = 0; i < result_length; i++) result->set_digit(i, product[i]);
+  } else {
+    result->InitializeDigits(result_length);
+    for (int i = 0; i < x->length(); i++) {
+      MutableBigInt::MultiplyAccumulate(y, x->digit(i), result, i);
+    }
   }
   result->set_sign(x->sign() != y->sign());
   return MutableBigInt::MakeImmutable(result);
@@ -1294,6 +1324,157 @@ void MutableBigInt::MultiplyAccumulate(Handle<BigIntBase> multiplicand,
   }
 }
 
+// Computes {result} = {x} * {y}. {result} must have room for
+// {x_length} + {y_length} digits and must not overlap the inputs.
+void MutableBigInt::MultiplyDigits(const digit_t* x, int x_length,
+                                   const digit_t* y, int y_length,
+                                   digit_t* result) {
+  if (x_length < y_length) {
+    std::swap(x, y);
+    std::swap(x_length, y_length);
+  }
+  int result_length = x_length + y_length;
+  std::fill(result, result + result_length, 0);
+  if (y_length < kKaratsubaThreshold) {
+    // Schoolbook multiplication, as in MultiplyAccumulate.
+    for (int i = 0; i < y_length; i++) {
+      digit_t multiplier = y[i];
+      if (multiplier == 0) continue;
+      digit_t carry = 0;
+      digit_t high = 0;
+      int index = i;
+      for (int j = 0; j < x_length; j++, index++) {
+        digit_t new_carry = 0;
+        digit_t acc = digit_add(result[index], high, &new_carry);
+        acc = digit_add(acc, carry, &new_carry);
+        digit_t low = digit_mul(multiplier, x[j], &high);
+        result[index] = digit_add(acc, low, &new_carry);
+        carry = new_carry;
+      }
+      for (; carry != 0 || high != 0; index++) {
+        DCHECK_LT(index, result_length);
+        digit_t new_carry = 0;
+        digit_t acc = digit_add(result[index], high, &new_carry);
+        high = 0;
+        result[index] = digit_add(acc, carry, &new_carry);
+        carry = new_carry;
+      }
+    }
+    return;
+  }
+  if (x_length >= 2 * y_length) {
+    // Very unbalanced operands: multiply {y} with {y_length}-sized chunks of
+    // {x} and accumulate the partial products.
+    std::vector<digit_t> product(2 * y_length);
+    for (int i = 0; i < x_length; i += y_length) {
+      int chunk_length = Min(y_length, x_length - i);
+      MultiplyDigits(x + i, chunk_length, y, y_length, product.data());
+      digit_t carry = AddDigits(result + i, result_length - i, product.data(),
+                                chunk_length + y_length);
+      DCHECK_EQ(0, carry);
+      USE(carry);
+    }
+    return;
+  }
+  KaratsubaMultiply(x, x_length, y, y_length, result);
+}
+
+// Splits both operands at {k} digits, x = x1 * B^k + x0, y = y1 * B^k + y0,
+// and computes x * y = z2 * B^2k + z1 * B^k + z0 with three recursive
+// multiplications: z0 = x0 * y0, z2 = x1 * y1 and
+// z1 = (x0 + x1) * (y0 + y1) - z0 - z2.
+void MutableBigInt::KaratsubaMultiply(const digit_t* x, int x_length,
+                                      const digit_t* y, int y_length,
+                                      digit_t* result) {
+  DCHECK_LE(y_length, x_length);
+  DCHECK_LT(x_length, 2 * y_length);
+  int k = x_length / 2;
+  int x1_length = x_length - k;
+  int y1_length = y_length - k;
+  DCHECK_GE(y1_length, 1);
+  int result_length = x_length + y_length;
+
+  // z0 and z2 are written directly into their final positions.
+  MultiplyDigits(x, k, y, k, result);
+  MultiplyDigits(x + k, x1_length, y + k, y1_length, result + 2 * k);
+
+  int sx_length = x1_length + 1;
+  std::vector<digit_t> sx(sx_length, 0);
+  std::copy(x + k, x + x_length, sx.begin());
+  AddDigits(sx.data(), sx_length, x, k);
+
+  int sy_length = Max(k, y1_length) + 1;
+  std::vector<digit_t> sy(sy_length, 0);
+  if (k >= y1_length) {
+    std::copy(y, y + k, sy.begin());
+    AddDigits(sy.data(), sy_length, y + k, y1_length);
+  } else {
+    std::copy(y + k, y + y_length, sy.begin());
+    AddDigits(sy.data(), sy_length, y, k);
+  }
+
+  int z1_length = sx_length + sy_length;
+  std::vector<digit_t> z1(z1_length);
+  MultiplyDigits(sx.data(), sx_length, sy.data(), sy_length, z1.data());
+  SubtractDigits(z1.data(), z1_length, result, 2 * k);
+  SubtractDigits(z1.data(), z1_length, result + 2 * k, result_length - 2 * k);
+
+  // z1 < B^(result_length - k), so its remaining high digits are zero.
+  int add_length = Min(z1_length, result_length - k);
+  for (int i = add_length; i < z1_length; i++) DCHECK_EQ(0, z1[i]);
+  digit_t carry = AddDigits(result + k, result_length - k, z1.data(),
+                            add_length);
+  DCHECK_EQ(0, carry);
+  USE(carry);
+}
+
+// Adds {summand} to {accumulator} in place and returns the carry out of
+// {accumulator}'s most significant digit.
+BigInt::digit_t MutableBigInt::AddDigits(digit_t* accumulator,
+                                         int accumulator_length,
+                                         const digit_t* summand,
+                                         int summand_length) {
+  DCHECK_LE(summand_length, accumulator_length);
+  digit_t carry = 0;
+  int i = 0;
+  for (; i < summand_length; i++) {
+    digit_t new_carry = 0;
+    digit_t sum = digit_add(accumulator[i], summand[i], &new_carry);
+    accumulator[i] = digit_add(sum, carry, &new_carry);
+    carry = new_carry;
+  }
+  for (; carry != 0 && i < accumulator_length; i++) {
+    digit_t new_carry = 0;
+    accumulator[i] = digit_add(accumulator[i], carry, &new_carry);
+    carry = new_carry;
+  }
+  return carry;
+}
+
+// Subtracts {subtrahend} from {accumulator} in place and returns the borrow
+// out of {accumulator}'s most significant digit.
+BigInt::digit_t MutableBigInt::SubtractDigits(digit_t* accumulator,
+                                              int accumulator_length,
+                                              const digit_t* subtrahend,
+                                              int subtrahend_length) {
+  DCHECK_LE(subtrahend_length, accumulator_length);
+  digit_t borrow = 0;
+  int i = 0;
+  for (; i < subtrahend_length; i++) {
+    digit_t new_borrow = 0;
+    digit_t difference =
+        digit_sub(accumulator[i], subtrahend[i], &new_borrow);
+    accumulator[i] = digit_sub(difference, borrow, &new_borrow);
+    borrow = new_borrow;
+  }
+  for (; borrow != 0 && i < accumulator_length; i++) {
+    digit_t new_borrow = 0;
+    accumulator[i] = digit_sub(accumulator[i], borrow, &new_borrow);
+    borrow = new_borrow;
+  }
+  return borrow;
+}
+
 // Multiplies {source} with {factor} and adds {summand} to the result.
 // {result} and {source} may be the same BigInt for inplace modification.
 void MutableBigInt::InternalMultiplyAdd(BigIntBase* source, digit_t factor,
@@ -500,9 +500,7 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  while (c0_ != kEndOfInput && !unibrow::IsLineTerminator(c0_)) {
-    Advance();
-  }
+  AdvanceUntil([](uc32 c0) { return unibrow::IsLineTerminator(c0); });
 
   return Token::WHITESPACE;
 }
@@ -510,9 +508,7 @@ Token::Value Scanner::SkipSingleLineComment() {
 
 Token::Value Scanner::SkipSourceURLComment() {
   TryToParseSourceURLComment();
-  while (c0_ != kEndOfInput && !unibrow::IsLineTerminator(c0_)) {
-    Advance();
-  }
+  AdvanceUntil([](uc32 c0) { return unibrow::IsLineTerminator(c0); });
 
   return Token::WHITESPACE;
 }
@@ -574,6 +570,11 @@ Token::Value Scanner::SkipMultiLineComment() {
   Advance();
 
   while (c0_ != kEndOfInput) {
+    // Only '*' and line terminators need to be looked at individually.
+    AdvanceUntil(
+        [](uc32 c0) { return c0 == '*' || unibrow::IsLineTerminator(c0); });
+    if (c0_ == kEndOfInput) break;
+
     uc32 ch = c0_;
     Advance();
     if (c0_ != kEndOfInput && unibrow::IsLineTerminator(ch)) {
@@ -7,6 +7,8 @@
 #ifndef V8_PARSING_SCANNER_H_
 #define V8_PARSING_SCANNER_H_
 
+#include <algorithm>
+
 #include "src/allocation.h"
 #include "src/base/logging.h"
 #include "src/char-predicates.h"
@@ -55,6 +57,29 @@ class Utf16CharacterStream {
     }
   }
 
+  // Advances past code units until one satisfies {check}, and returns and
+  // advances past that one. Returns kEndOfInput if the input ends first. The
+  // scan runs directly over the buffered block, without a call per code unit.
+  template <typename FunctionType>
+  V8_INLINE uc32 AdvanceUntil(FunctionType check) {
+    while (true) {
+      const uint16_t* next_cursor_pos =
+          std::find_if(buffer_cursor_, buffer_end_, [&check](uint16_t raw_c0) {
+            return check(static_cast<uc32>(raw_c0));
+          });
+      if (next_cursor_pos != buffer_end_) {
+        buffer_cursor_ = next_cursor_pos + 1;
+        return static_cast<uc32>(*next_cursor_pos);
+      }
+      buffer_cursor_ = buffer_end_;
+      if (!ReadBlockChecked()) {
+        // See Advance() for why the cursor moves past the end.
+        buffer_cursor_++;
+        return kEndOfInput;
+      }
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -617,6 +642,14 @@ class Scanner {
     if (check_surrogate) HandleLeadSurrogate();
   }
 
+  // Skips characters until c0_ satisfies {check} or the input ends. {check}
+  // must not accept surrogates, as no surrogate pairs are combined on the way.
+  template <typename FunctionType>
+  V8_INLINE void AdvanceUntil(FunctionType check) {
+    if (c0_ == kEndOfInput || check(c0_)) return;
+    c0_ = source_->AdvanceUntil(check);
+  }
+
   void HandleLeadSurrogate() {
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
       uc32 c1 = source_->Advance();
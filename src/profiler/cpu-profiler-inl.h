@@ -52,7 +52,10 @@ void ReportBuiltinEventRecord::UpdateCodeMap(CodeMap* code_map) {
 
 TickSample* ProfilerEventsProcessor::StartTickSample() {
   void* address = ticks_buffer_.StartEnqueue();
-  if (address == nullptr) return nullptr;
+  if (address == nullptr) {
+    dropped_samples_.Increment(1);
+    return nullptr;
+  }
   TickSampleEventRecord* evt =
       new (address) TickSampleEventRecord(last_code_event_id_.Value());
   return &evt->sample;
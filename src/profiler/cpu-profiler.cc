@@ -51,6 +51,7 @@ ProfilerEventsProcessor::ProfilerEventsProcessor(Isolate* isolate,
       running_(1),
       period_(period),
       last_code_event_id_(0),
+      dropped_samples_(0),
       last_processed_code_event_id_(0) {
   sampler_->IncreaseProfilingDepth();
 }
@@ -413,6 +414,8 @@ void CpuProfiler::StopProcessor() {
   ProfilerListener* profiler_listener = logger->profiler_listener();
   profiler_listener->RemoveObserver(this);
   processor_->StopSynchronously();
+  isolate_->counters()->cpu_profiler_dropped_samples()->Increment(
+      static_cast<int>(processor_->dropped_samples()));
   logger->TearDownProfilerListener();
   processor_.reset();
   generator_.reset();
@@ -159,6 +159,9 @@ class ProfilerEventsProcessor : public base::Thread {
 
   sampler::Sampler* sampler() { return sampler_.get(); }
 
+  // Number of stack samples dropped because the tick sample buffer was full.
+  unsigned dropped_samples() const { return dropped_samples_.Value(); }
+
  private:
   // Called from events processing thread (Run() method.)
   bool ProcessCodeEvent();
@@ -182,6 +185,7 @@ class ProfilerEventsProcessor : public base::Thread {
                         kTickSampleQueueLength> ticks_buffer_;
   LockedQueue<TickSampleEventRecord> ticks_from_vm_buffer_;
   base::AtomicNumber<unsigned> last_code_event_id_;
+  base::AtomicNumber<unsigned> dropped_samples_;
   unsigned last_processed_code_event_id_;
 };
 
@@ -491,6 +491,7 @@ void CodeMap::AddCode(Address addr, CodeEntry* entry, unsigned size) {
 }
 
 void CodeMap::DeleteAllCoveredCode(Address start, Address end) {
+  ClearCache();
   auto left = code_map_.upper_bound(start);
   if (left != code_map_.begin()) {
     --left;
@@ -502,11 +503,16 @@ void CodeMap::DeleteAllCoveredCode(Address start, Address end) {
 }
 
 CodeEntry* CodeMap::FindEntry(Address addr) {
+  if (cache_start_ <= addr && addr < cache_end_) return cache_entry_;
   auto it = code_map_.upper_bound(addr);
   if (it == code_map_.begin()) return nullptr;
   --it;
   Address end_address = it->first + it->second.size;
-  return addr < end_address ? it->second.entry : nullptr;
+  if (addr >= end_address) return nullptr;
+  cache_start_ = it->first;
+  cache_end_ = end_address;
+  cache_entry_ = it->second.entry;
+  return cache_entry_;
 }
 
 void CodeMap::MoveCode(Address from, Address to) {
@@ -515,6 +521,7 @@ void CodeMap::MoveCode(Address from, Address to) {
   if (it == code_map_.end()) return;
   CodeEntryInfo info = it->second;
   code_map_.erase(it);
+  ClearCache();
   AddCode(to, info.entry, info.size);
 }
 
@@ -314,7 +314,8 @@ class CpuProfile {
 
 class CodeMap {
  public:
-  CodeMap() {}
+  CodeMap()
+      : cache_start_(nullptr), cache_end_(nullptr), cache_entry_(nullptr) {}
 
   void AddCode(Address addr, CodeEntry* entry, unsigned size);
   void MoveCode(Address from, Address to);
@@ -330,9 +331,16 @@ class CodeMap {
   };
 
   void DeleteAllCoveredCode(Address start, Address end);
+  void ClearCache() { cache_start_ = cache_end_ = nullptr; }
 
   std::map<Address, CodeEntryInfo> code_map_;
 
+  // Consecutive samples usually hit the same code object, so the range of
+  // the last successful FindEntry is remembered to avoid a tree lookup.
+  Address cache_start_;
+  Address cache_end_;
+  CodeEntry* cache_entry_;
+
   DISALLOW_COPY_AND_ASSIGN(CodeMap);
 };
 
@@ -100,6 +100,92 @@ bool CompareNum(T x, T y) {
   return false;
 }
 
+// Below this length std::sort beats the fixed per-pass cost of a radix sort.
+const size_t kRadixSortThreshold = 1024;
+
+// Maps an integer to an unsigned key with the same ordering.
+template <typename T>
+typename std::make_unsigned<T>::type RadixKey(T value) {
+  typedef typename std::make_unsigned<T>::type U;
+  U key = static_cast<U>(value);
+  if (std::is_signed<T>::value) key ^= U{1} << (sizeof(T) * kBitsPerByte - 1);
+  return key;
+}
+
+// Sorts single-byte elements by counting the occurrences of each value.
+template <typename T>
+void CountingSort(T* data, size_t length) {
+  size_t counts[256] = {0};
+  for (size_t i = 0; i < length; i++) counts[RadixKey(data[i])]++;
+  T* out = data;
+  for (int key = 0; key < 256; key++) {
+    T value = static_cast<T>(static_cast<uint8_t>(key) ^ RadixKey(T{0}));
+    out = std::fill_n(out, counts[key], value);
+  }
+}
+
+// LSD radix sort on byte digits, using {scratch} of the same length as
+// temporary storage. Passes in which all elements share a digit are skipped.
+template <typename T>
+void RadixSort(T* data, T* scratch, size_t length) {
+  T* from = data;
+  T* to = scratch;
+  for (size_t digit = 0; digit < sizeof(T); digit++) {
+    int shift = static_cast<int>(digit * kBitsPerByte);
+    size_t offsets[257] = {0};
+    for (size_t i = 0; i < length; i++) {
+      offsets[((RadixKey(from[i]) >> shift) & 0xFF) + 1]++;
+    }
+    bool trivial = false;
+    for (int key = 0; key < 256; key++) {
+      if (offsets[key + 1] == length) trivial = true;
+      offsets[key + 1] += offsets[key];
+    }
+    if (trivial) continue;
+    for (size_t i = 0; i < length; i++) {
+      to[offsets[(RadixKey(from[i]) >> shift) & 0xFF]++] = from[i];
+    }
+    std::swap(from, to);
+  }
+  if (from != data) std::copy(from, from + length, data);
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value>::type SortElements(
+    T* data, size_t length, bool is_shared) {
+  std::sort(data, data + length, CompareNum<T>);
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value>::type SortElements(
+    T* data, size_t length, bool is_shared) {
+  if (sizeof(T) == 1) {
+    CountingSort(data, length);
+    return;
+  }
+  if (length >= kRadixSortThreshold) {
+    if (is_shared) {
+      // Other threads can change the elements of a SharedArrayBuffer between
+      // the counting and the scatter pass, which would overflow a bucket. Sort
+      // a private copy instead and write the result back once.
+      std::unique_ptr<T[]> copy(new (std::nothrow) T[2 * length]);
+      if (copy) {
+        std::copy(data, data + length, copy.get());
+        RadixSort(copy.get(), copy.get() + length, length);
+        std::copy(copy.get(), copy.get() + length, data);
+        return;
+      }
+    } else {
+      std::unique_ptr<T[]> scratch(new (std::nothrow) T[length]);
+      if (scratch) {
+        RadixSort(data, scratch.get(), length);
+        return;
+      }
+    }
+  }
+  std::sort(data, data + length);
+}
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
@@ -122,17 +208,12 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
 
   Handle<FixedTypedArrayBase> elements(
       FixedTypedArrayBase::cast(array->elements()));
+  const bool is_shared = JSArrayBuffer::cast(array->buffer())->is_shared();
   switch (array->type()) {
-#define TYPED_ARRAY_SORT(Type, type, TYPE, ctype, size)     \
-  case kExternal##Type##Array: {                            \
-    ctype* data = static_cast<ctype*>(elements->DataPtr()); \
-    if (kExternal##Type##Array == kExternalFloat64Array ||  \
-        kExternal##Type##Array == kExternalFloat32Array)    \
-      std::sort(data, data + length, CompareNum<ctype>);    \
-    else                                                    \
-      std::sort(data, data + length);                       \
-    break;                                                  \
-  }
+#define TYPED_ARRAY_SORT(Type, type, TYPE, ctype, size)                       \
+  case kExternal##Type##Array:                                                \
+    SortElements(static_cast<ctype*>(elements->DataPtr()), length, is_shared); \
+    break;
 
     TYPED_ARRAYS(TYPED_ARRAY_SORT)
 #undef TYPED_ARRAY_SORT
@@ -315,10 +315,14 @@ void Deserializer<AllocatorT>::ReadObject(
   MaybeObject** current = reinterpret_cast<MaybeObject**>(address);
   MaybeObject** limit = current + (size >> kPointerSizeLog2);
 
-  if (ReadData(current, limit, space_number, address)) {
+  bool has_content = ReadData(current, limit, space_number, address);
+  if (has_content) {
     // Only post process if object content has not been deferred.
     obj = PostProcessNewObject(obj, space_number);
   }
+  if (FLAG_profile_deserialization) {
+    CountObject(space_number, obj, size, has_content);
+  }
 
   MaybeObject* write_back_obj =
       reference_type == HeapObjectReferenceType::STRONG
@@ -334,6 +338,43 @@ void Deserializer<AllocatorT>::ReadObject(
 #endif  // DEBUG
 }
 
+template <class AllocatorT>
+void Deserializer<AllocatorT>::CountObject(int space, HeapObject* obj, int size,
+                                           bool has_content) {
+  space_object_count_[space]++;
+  space_object_size_[space] += size;
+  if (!has_content) return;
+  if (instance_type_count_.empty()) {
+    instance_type_count_.resize(kInstanceTypes, 0);
+    instance_type_size_.resize(kInstanceTypes, 0);
+  }
+  int instance_type = obj->map()->instance_type();
+  instance_type_count_[instance_type]++;
+  instance_type_size_[instance_type] += size;
+}
+
+template <class AllocatorT>
+void Deserializer<AllocatorT>::OutputStatistics(const char* name) {
+  if (!FLAG_profile_deserialization) return;
+  for (int space = 0; space < kNumberOfSpaces; space++) {
+    if (space_object_count_[space] == 0) continue;
+    PrintF("deserialization snapshot=%s space=%s objects=%d bytes=%" PRIuS
+           "\n",
+           name, AllocationSpaceName(static_cast<AllocationSpace>(space)),
+           space_object_count_[space], space_object_size_[space]);
+  }
+  if (instance_type_count_.empty()) return;
+#define PRINT_INSTANCE_TYPE(Name)                                           \
+  if (instance_type_count_[Name]) {                                         \
+    PrintF("deserialization snapshot=%s type=%s objects=%d bytes=%" PRIuS \
+           "\n",                                                            \
+           name, #Name, instance_type_count_[Name],                         \
+           instance_type_size_[Name]);                                      \
+  }
+  INSTANCE_TYPE_LIST(PRINT_INSTANCE_TYPE)
+#undef PRINT_INSTANCE_TYPE
+}
+
 template <class AllocatorT>
 Object* Deserializer<AllocatorT>::ReadDataSingle() {
   MaybeObject* o;
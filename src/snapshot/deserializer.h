@@ -36,6 +36,10 @@ class Deserializer : public SerializerDeserializer {
 
   void SetRehashability(bool v) { can_rehash_ = v; }
 
+  // Prints the per-space and per-instance-type object counts and sizes
+  // collected under --profile-deserialization, one name=value line each.
+  void OutputStatistics(const char* name);
+
  protected:
   // Create a deserializer from a snapshot byte source.
   template <class Data>
@@ -134,6 +138,10 @@ class Deserializer : public SerializerDeserializer {
   // Special handling for serialized code like hooking up internalized strings.
   HeapObject* PostProcessNewObject(HeapObject* obj, int space);
 
+  // Records a deserialized object for --profile-deserialization. The instance
+  // type is only known if the object's content has not been deferred.
+  void CountObject(int space, HeapObject* obj, int size, bool has_content);
+
   // May replace the given builtin_id with the DeserializeLazy builtin for lazy
   // deserialization.
   int MaybeReplaceWithDeserializeLazy(int builtin_id);
@@ -163,6 +171,13 @@ class Deserializer : public SerializerDeserializer {
   bool can_rehash_;
   std::vector<HeapObject*> to_rehash_;
 
+  // Statistics collected under --profile-deserialization.
+  static const int kInstanceTypes = LAST_TYPE + 1;
+  int space_object_count_[kNumberOfSpaces] = {};
+  size_t space_object_size_[kNumberOfSpaces] = {};
+  std::vector<int> instance_type_count_;
+  std::vector<size_t> instance_type_size_;
+
 #ifdef DEBUG
   uint32_t num_api_references_;
 #endif  // DEBUG
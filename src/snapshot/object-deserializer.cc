@@ -28,9 +28,10 @@ ObjectDeserializer::DeserializeSharedFunctionInfo(
   }
 
   Handle<HeapObject> result;
-  return d.Deserialize(isolate).ToHandle(&result)
-             ? Handle<SharedFunctionInfo>::cast(result)
-             : MaybeHandle<SharedFunctionInfo>();
+  bool success = d.Deserialize(isolate).ToHandle(&result);
+  d.OutputStatistics("code cache");
+  return success ? Handle<SharedFunctionInfo>::cast(result)
+                 : MaybeHandle<SharedFunctionInfo>();
 }
 
 MaybeHandle<WasmCompiledModule>
@@ -20,6 +20,7 @@ MaybeHandle<Context> PartialDeserializer::DeserializeContext(
 
   MaybeHandle<Object> maybe_result =
       d.Deserialize(isolate, global_proxy, embedder_fields_deserializer);
+  d.OutputStatistics("context");
 
   Handle<Object> result;
   return maybe_result.ToHandle(&result) ? Handle<Context>::cast(result)
@@ -56,6 +56,7 @@ bool Snapshot::Initialize(Isolate* isolate) {
     double ms = timer.Elapsed().InMillisecondsF();
     int bytes = startup_data.length();
     PrintF("[Deserializing isolate (%d bytes) took %0.3f ms]\n", bytes, ms);
+    deserializer.OutputStatistics("startup");
   }
   return success;
 }
@@ -622,9 +622,19 @@ Maybe<bool> ValueSerializer::WriteJSArray(Handle<JSArray> array) {
         if (length == 0) break;
         Handle<FixedDoubleArray> elements(
             FixedDoubleArray::cast(array->elements()), isolate_);
+        // Every element is encoded as a tag followed by the raw double, so
+        // reserve the space for all of them at once.
+        const size_t element_size = 1 + sizeof(double);
+        uint8_t* dest;
+        if (!ReserveRawBytes(length * element_size).To(&dest)) {
+          return ThrowIfOutOfMemory();
+        }
         for (; i < length; i++) {
-          WriteTag(SerializationTag::kDouble);
-          WriteDouble(elements->get_scalar(i));
+          // Warning: this uses host endianness, as in WriteDouble.
+          double value = elements->get_scalar(i);
+          *dest++ = static_cast<uint8_t>(SerializationTag::kDouble);
+          memcpy(dest, &value, sizeof(value));
+          dest += sizeof(value);
         }
         break;
       }
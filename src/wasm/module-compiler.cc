@@ -1085,16 +1085,24 @@ class CompilationUnitBuilder {
         name, function->func_index, centry_stub_,
         compiler::WasmCompilationUnit::GetDefaultCompilationMode(),
         compilation_state_->isolate()->async_counters().get()));
+    uncommitted_bytes_ += bytes.length();
   }
 
   bool Commit() {
     if (units_.empty()) return false;
     compilation_state_->AddCompilationUnits(units_);
     units_.clear();
+    uncommitted_bytes_ = 0;
     return true;
   }
 
-  void Clear() { units_.clear(); }
+  void Clear() {
+    units_.clear();
+    uncommitted_bytes_ = 0;
+  }
+
+  // Total size of the function bodies added since the last {Commit}.
+  size_t uncommitted_bytes() const { return uncommitted_bytes_; }
 
  private:
   NativeModule* native_module_;
@@ -1102,6 +1110,7 @@ class CompilationUnitBuilder {
   compiler::ModuleEnv* module_env_;
   Handle<Code> centry_stub_;
   std::vector<std::unique_ptr<compiler::WasmCompilationUnit>> units_;
+  size_t uncommitted_bytes_ = 0;
 };
 
 // Run by each compilation task and by the main thread (i.e. in both
@@ -2802,6 +2811,10 @@ class AsyncStreamingProcessor final : public StreamingProcessor {
 
   void CommitCompilationUnits();
 
+  // Upper bound on the function body bytes buffered in
+  // {compilation_unit_builder_} before they get committed.
+  static constexpr size_t kMaxUncommittedBytes = 64 * KB;
+
   ModuleDecoder decoder_;
   AsyncCompileJob* job_;
   std::unique_ptr<CompilationUnitBuilder> compilation_unit_builder_;
@@ -3307,6 +3320,13 @@ bool AsyncStreamingProcessor::ProcessFunctionBody(Vector<const uint8_t> bytes,
     const WasmFunction* func = &decoder_.module()->functions[index];
     WasmName name = {nullptr, 0};
     compilation_unit_builder_->AddUnit(func, offset, bytes, name);
+    // A single network chunk can contain many function bodies. Hand them to
+    // the background tasks in batches so that compilation overlaps with the
+    // decoding of the rest of the chunk.
+    if (compilation_unit_builder_->uncommitted_bytes() >=
+        kMaxUncommittedBytes) {
+      CommitCompilationUnits();
+    }
   }
   ++next_function_;
   // This method always succeeds. The return value is necessary to comply with
@@ -772,10 +772,17 @@ void WasmCodeManager::TryAllocate(size_t size, VirtualMemory* ret, void* hint) {
   size = RoundUp(size, AllocatePageSize());
   if (hint == nullptr) hint = GetRandomMmapAddr();
 
-  if (!AlignedAllocVirtualMemory(size, static_cast<size_t>(AllocatePageSize()),
-                                 hint, ret)) {
+  size_t alignment = AllocatePageSize();
+  if (FLAG_huge_pages) {
+    size = RoundUp(size, kHugePageSize);
+    alignment = Max(alignment, kHugePageSize);
+  }
+  if (!AlignedAllocVirtualMemory(size, alignment, hint, ret)) {
     DCHECK(!ret->IsReserved());
   }
+  if (FLAG_huge_pages && ret->IsReserved()) {
+    AdviseHugePages(ret->address(), ret->size());
+  }
   TRACE_HEAP("VMem alloc: %p:%p (%zu)\n", ret->address(), ret->end(),
              ret->size());
 }
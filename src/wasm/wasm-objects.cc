@@ -369,10 +369,15 @@ Handle<JSArrayBuffer> GrowMemoryBuffer(Isolate* isolate,
       new_size > kMaxInt) {
     return Handle<JSArrayBuffer>::null();
   }
-  if (((use_trap_handler && !old_buffer->is_external() &&
-        new_size < old_buffer->allocation_length()) ||
-       old_size == new_size) &&
-      old_size != 0) {
+  // Memory allocated by the WasmMemoryTracker reserves more address space
+  // than it makes accessible: the full guard region with trap handlers, or the
+  // next power of two otherwise. Grow into that reservation in place and only
+  // fall back to allocating and copying when it is exhausted.
+  bool grow_in_place =
+      old_size == new_size ||
+      (old_buffer->is_wasm_memory() && !old_buffer->is_external() &&
+       new_size <= old_buffer->allocation_length());
+  if (grow_in_place && old_size != 0) {
     DCHECK_NOT_NULL(old_buffer->backing_store());
     if (old_size != new_size) {
       // If adjusting permissions fails, propagate error back to return
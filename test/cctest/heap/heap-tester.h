@@ -10,7 +10,9 @@
 // Tests that should have access to private methods of {v8::internal::Heap}.
 // Those tests need to be defined using HEAP_TEST(Name) { ... }.
 #define HEAP_TEST_METHODS(V)                              \
+  V(AllocationSitePretenuringRevisit)                     \
   V(CompactionFullAbortedPage)                            \
+  V(CompactionPauseBudget)                                \
   V(CompactionPartiallyAbortedPage)                       \
   V(CompactionPartiallyAbortedPageIntraAbortedPointers)   \
   V(CompactionPartiallyAbortedPageWithStoreBufferEntries) \
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include "src/api.h"
+#include "src/heap/array-buffer-collector.h"
 #include "src/heap/array-buffer-tracker.h"
 #include "src/heap/spaces.h"
 #include "src/isolate.h"
@@ -373,6 +374,39 @@ TEST(ArrayBuffer_RetainedSizeDecreases) {
   CHECK_EQ(0, retained_after - retained_before);
 }
 
+TEST(ArrayBuffer_PoolRecyclesBackingStores) {
+  ManualGCScope manual_gc_scope;
+  FLAG_array_buffer_pool = true;
+  FLAG_concurrent_array_buffer_freeing = false;
+  CcTest::InitializeVM();
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  Heap* heap = reinterpret_cast<Isolate*>(isolate)->heap();
+
+  const size_t kArraybufferSize = 256;
+  heap->array_buffer_collector()->ReleasePool();
+  void* backing_store = nullptr;
+  {
+    v8::HandleScope handle_scope(isolate);
+    Local<v8::ArrayBuffer> ab = v8::ArrayBuffer::New(isolate, kArraybufferSize);
+    backing_store = ab->GetContents().Data();
+    memset(backing_store, 0xAB, kArraybufferSize);
+  }
+  heap::GcAndSweep(heap, OLD_SPACE);
+  CHECK_EQ(kArraybufferSize, heap->array_buffer_collector()->pool_size());
+  {
+    v8::HandleScope handle_scope(isolate);
+    Local<v8::ArrayBuffer> ab = v8::ArrayBuffer::New(isolate, kArraybufferSize);
+    CHECK_EQ(backing_store, ab->GetContents().Data());
+    CHECK_EQ(0u, heap->array_buffer_collector()->pool_size());
+    uint8_t* data = static_cast<uint8_t*>(ab->GetContents().Data());
+    for (size_t i = 0; i < kArraybufferSize; i++) {
+      CHECK_EQ(0, data[i]);
+    }
+  }
+  heap->array_buffer_collector()->ReleasePool();
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
@@ -26,6 +26,7 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdlib.h>
+#include <limits>
 #include <utility>
 
 #include "src/api.h"
@@ -5945,6 +5946,192 @@ HEAP_TEST(Regress779503) {
   CcTest::heap()->delay_sweeper_tasks_for_testing_ = false;
 }
 
+namespace {
+
+int heap_soft_limit_callbacks = 0;
+
+void HeapSoftLimitCallback(v8::Isolate* isolate, size_t heap_size,
+                           size_t soft_limit, void* data) {
+  CHECK_EQ(CcTest::isolate(), isolate);
+  CHECK_GT(heap_size, soft_limit);
+  CHECK_EQ(&heap_soft_limit_callbacks, data);
+  heap_soft_limit_callbacks++;
+}
+
+void AllocateAboveHeapSoftLimit(Isolate* isolate) {
+  // Large enough to cross the limit set in the test below on every platform.
+  const int kArrays = 8;
+  const int kLength = 64 * KB;
+  for (int i = 0; i < kArrays; i++) {
+    isolate->factory()->NewFixedArray(kLength, TENURED);
+  }
+}
+
+}  // namespace
+
+TEST(HeapSoftLimit) {
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Heap* heap = CcTest::heap();
+  CcTest::CollectAllGarbage();
+  heap_soft_limit_callbacks = 0;
+  isolate->SetHeapSoftLimit(heap->SizeOfObjects() + MB, HeapSoftLimitCallback,
+                            &heap_soft_limit_callbacks);
+  CHECK(!heap->HeapSoftLimitReached());
+  {
+    HandleScope scope(CcTest::i_isolate());
+    AllocateAboveHeapSoftLimit(CcTest::i_isolate());
+    CcTest::CollectAllGarbage();
+    CHECK(heap->HeapSoftLimitReached());
+    CHECK(heap->ShouldOptimizeForMemoryUsage());
+    // The callback is invoked from a foreground task.
+    CHECK_EQ(0, heap_soft_limit_callbacks);
+    EmptyMessageQueues(isolate);
+    CHECK_EQ(1, heap_soft_limit_callbacks);
+    // Staying above the limit does not count as another crossing.
+    CcTest::CollectAllGarbage();
+    EmptyMessageQueues(isolate);
+    CHECK_EQ(1, heap_soft_limit_callbacks);
+  }
+  // Dropping below the limit re-arms the callback.
+  CcTest::CollectAllGarbage();
+  CHECK(!heap->HeapSoftLimitReached());
+  EmptyMessageQueues(isolate);
+  CHECK_EQ(1, heap_soft_limit_callbacks);
+  {
+    HandleScope scope(CcTest::i_isolate());
+    AllocateAboveHeapSoftLimit(CcTest::i_isolate());
+    CcTest::CollectAllGarbage();
+    CHECK(heap->HeapSoftLimitReached());
+    EmptyMessageQueues(isolate);
+    CHECK_EQ(2, heap_soft_limit_callbacks);
+  }
+  isolate->SetHeapSoftLimit(0, nullptr);
+}
+
+TEST(ReduceMemoryForDormantIsolate) {
+  FLAG_reduce_memory_when_dormant = true;
+  // Compaction would evacuate the survivors and release the fragmented pages
+  // instead of leaving free list entries behind.
+  FLAG_never_compact = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+  heap::SealCurrentObjects(heap);
+  // Leave large free list entries between surviving objects.
+  const int kArrays = 64;
+  const int kLength = 4 * KB;
+  std::vector<Handle<FixedArray>> survivors;
+  for (int i = 0; i < kArrays; i++) {
+    if (i % 8 == 0) {
+      survivors.push_back(factory->NewFixedArray(kLength, TENURED));
+    } else {
+      HandleScope inner_scope(isolate);
+      factory->NewFixedArray(kLength, TENURED);
+    }
+  }
+  CcTest::CollectAllGarbage();
+  heap->mark_compact_collector()->EnsureSweepingCompleted();
+
+  CcTest::isolate()->IsolateInBackgroundNotification();
+  CHECK_LT(0u, heap->ReduceMemoryForDormantIsolate());
+  CHECK_EQ(heap->new_space()->InitialTotalCapacity(),
+           heap->new_space()->TotalCapacity());
+
+  // The discarded free list entries are reused without growing the space.
+  const size_t committed = heap->old_space()->CommittedMemory();
+  for (int i = 0; i < kArrays - static_cast<int>(survivors.size()); i++) {
+    factory->NewFixedArray(kLength, TENURED);
+  }
+  CHECK_EQ(committed, heap->old_space()->CommittedMemory());
+  for (Handle<FixedArray> array : survivors) {
+    CHECK_EQ(kLength, array->length());
+  }
+#ifdef VERIFY_HEAP
+  heap->Verify();
+#endif
+  CcTest::isolate()->IsolateInForegroundNotification();
+}
+
+HEAP_TEST(AllocationSitePretenuringRevisit) {
+  FLAG_allocation_site_pretenuring_revisit = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+  Handle<AllocationSite> site = isolate->factory()->NewAllocationSite();
+  site->set_pretenure_decision(AllocationSite::kDontTenure);
+  // All mementos of the site were found, i.e. its objects survived.
+  site->set_memento_create_count(AllocationSite::kPretenureMinimumCreated);
+  site->set_memento_found_count(AllocationSite::kPretenureMinimumCreated);
+  heap->global_pretenuring_feedback_[*site] = 0;
+  heap->ProcessPretenuringFeedback();
+  CHECK_EQ(AllocationSite::kMaybeTenure, site->pretenure_decision());
+  CHECK_EQ(0, site->memento_found_count());
+}
+
+TEST(GCStatistics) {
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  CcTest::CollectGarbage(NEW_SPACE);
+  CcTest::CollectAllGarbage();
+  size_t count = isolate->NumberOfRecordedGCStatistics();
+  CHECK_LE(2u, count);
+
+  v8::GCStatistics full;
+  CHECK(isolate->GetGCStatistics(&full, 0));
+  CHECK_EQ(v8::kGCTypeMarkSweepCompact, full.gc_type());
+  CHECK_LE(full.mark_duration() + full.sweep_duration(),
+           full.pause_duration());
+  v8::GCStatistics scavenge;
+  CHECK(isolate->GetGCStatistics(&scavenge, 1));
+  CHECK_EQ(v8::kGCTypeScavenge, scavenge.gc_type());
+  CHECK_LE(scavenge.start_time(), full.start_time());
+
+  CHECK(!isolate->GetGCStatistics(&full, count));
+}
+
+UNINITIALIZED_TEST(MemoryFootprintStats) {
+  // Prints the fixed memory overhead of an isolate and of a context, for
+  // tracking by test/memory/Footprint.json.
+  const int kContexts = 10;
+  FLAG_always_opt = false;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+    Heap* heap = i_isolate->heap();
+    size_t isolate_committed[LAST_SPACE + 1];
+    for (int i = FIRST_SPACE; i <= LAST_SPACE; i++) {
+      isolate_committed[i] = heap->space(i)->CommittedMemory();
+      PrintF("%10" PRIuS " bytes per isolate in %s\n", isolate_committed[i],
+             heap->GetSpaceName(i));
+    }
+    PrintF("%10" PRIuS " bytes per isolate in zones\n",
+           i_isolate->allocator()->GetCurrentMemoryUsage());
+
+    v8::HandleScope handle_scope(isolate);
+    for (int i = 0; i < kContexts; i++) {
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      CompileRun("var x = 1;");
+    }
+    for (int i = FIRST_SPACE; i <= LAST_SPACE; i++) {
+      size_t committed = heap->space(i)->CommittedMemory();
+      size_t delta = committed > isolate_committed[i]
+                         ? committed - isolate_committed[i]
+                         : 0;
+      PrintF("%10" PRIuS " bytes per context in %s\n", delta / kContexts,
+             heap->GetSpaceName(i));
+    }
+  }
+  isolate->Dispose();
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
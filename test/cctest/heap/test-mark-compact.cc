@@ -170,6 +170,44 @@ HEAP_TEST(MarkCompactCollector) {
   }
 }
 
+HEAP_TEST(CompactionPauseBudget) {
+  CcTest::InitializeVM();
+  Heap* heap = CcTest::heap();
+  if (heap->ShouldReduceMemory() || heap->ShouldOptimizeForMemoryUsage()) {
+    return;
+  }
+  MarkCompactCollector* collector = heap->mark_compact_collector();
+  const size_t area_size = heap->old_space()->AreaSize();
+
+  // Fill the tracer's ring buffer with samples of exactly 1MB/ms.
+  for (int i = 0; i < base::RingBuffer<double>::kSize; i++) {
+    heap->tracer()->AddCompactionEvent(1, 1 * MB);
+  }
+
+  int target_fragmentation_percent = 0;
+  size_t unbounded_bytes = 0;
+  FLAG_compaction_pause_budget_ms = 0;
+  collector->ComputeEvacuationHeuristics(
+      area_size, &target_fragmentation_percent, &unbounded_bytes);
+
+  size_t budget_bytes = 0;
+  FLAG_compaction_pause_budget_ms = 1;
+  collector->ComputeEvacuationHeuristics(
+      area_size, &target_fragmentation_percent, &budget_bytes);
+  CHECK_LT(budget_bytes, unbounded_bytes);
+  CHECK_EQ(Max(area_size, static_cast<size_t>(1 * MB)), budget_bytes);
+
+  // A budget that is too small for a single area still allows one area.
+  // Pushing a full ring buffer of samples replaces the previous ones.
+  for (int i = 0; i < base::RingBuffer<double>::kSize; i++) {
+    heap->tracer()->AddCompactionEvent(1, 1 * KB);
+  }
+  collector->ComputeEvacuationHeuristics(
+      area_size, &target_fragmentation_percent, &budget_bytes);
+  CHECK_EQ(area_size, budget_bytes);
+  FLAG_compaction_pause_budget_ms = 0;
+}
+
 
 // TODO(1600): compaction of map space is temporary removed from GC.
 #if 0
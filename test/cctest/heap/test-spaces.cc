@@ -747,6 +747,44 @@ TEST(ShrinkPageToHighWaterMarkTwoWordFiller) {
   CHECK_EQ(0u, shrunk);
 }
 
+TEST(SizeClassAllocationReusesSmallEntries) {
+  FLAG_stress_incremental_marking = false;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+  heap::SealCurrentObjects(heap);
+
+  // Turn two adjacent arrays into a small and a large free list entry.
+  Handle<FixedArray> small = isolate->factory()->NewFixedArray(2, TENURED);
+  Handle<FixedArray> large = isolate->factory()->NewFixedArray(1000, TENURED);
+  Address small_address = small->address();
+  size_t small_size = small->Size();
+  Address large_address = large->address();
+  size_t large_size = large->Size();
+  PagedSpace* old_space = heap->old_space();
+  old_space->FreeLinearAllocationArea();
+  old_space->ResetFreeList();
+  old_space->Free(small_address, small_size,
+                  SpaceAccountingMode::kSpaceAccounted);
+  old_space->Free(large_address, large_size,
+                  SpaceAccountingMode::kSpaceAccounted);
+
+  FreeList* free_list = old_space->free_list();
+  size_t node_size = 0;
+  FLAG_size_class_allocation = false;
+  FreeSpace* node = free_list->Allocate(small_size, &node_size);
+  CHECK_EQ(large_address, node->address());
+  free_list->Free(node->address(), node_size, kLinkCategory);
+
+  FLAG_size_class_allocation = true;
+  node = free_list->Allocate(small_size, &node_size);
+  CHECK_EQ(small_address, node->address());
+  CHECK_EQ(small_size, node_size);
+  free_list->Free(node->address(), node_size, kLinkCategory);
+  FLAG_size_class_allocation = false;
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
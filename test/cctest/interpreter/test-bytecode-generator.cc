@@ -1678,6 +1678,31 @@ TEST(Switch) {
     "   }  // fall-through\n"
     " case 2: a = 3;\n"
     "}\n",
+
+    "var a = 1;\n"
+    "switch(a) {\n"
+    " case 1: return 2;\n"
+    " case 2: return 3;\n"
+    " case 3: return 4;\n"
+    " case 4: return 5;\n"
+    " default: return 6;\n"
+    "}\n",
+
+    "var a = 1;\n"
+    "switch(a) {\n"
+    " case 1: return 2;\n"
+    " case 2: return 3;\n"
+    " case 4: return 4;\n"
+    " case 6: return 5;\n"
+    "}\n",
+
+    "var a = 1;\n"
+    "switch(a) {\n"
+    " case 1: return 2;\n"
+    " case 2: return 3;\n"
+    " case 1: return 4;\n"
+    " case 3: return 5;\n"
+    "}\n",
   };
 
   CHECK(CompareTexts(BuildActual(printer, snippets),
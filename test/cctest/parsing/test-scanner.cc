@@ -131,5 +131,28 @@ TEST(ContextualKeywordTokens) {
   CHECK_TOK(Token::UNINITIALIZED, scanner->current_contextual_token());
 }
 
+TEST(SkipComments) {
+  const struct {
+    const char* src;
+    const Token::Value tokens[4];  // Large enough for any of the test cases.
+  } test_cases[] = {
+      {"// comment only", {Token::EOS}},
+      {"a // comment\nb", {Token::IDENTIFIER, Token::IDENTIFIER, Token::EOS}},
+      {"a /* x * y \n */ b",
+       {Token::IDENTIFIER, Token::IDENTIFIER, Token::EOS}},
+      {"a /**/b", {Token::IDENTIFIER, Token::IDENTIFIER, Token::EOS}},
+      {"a /* *** */ b", {Token::IDENTIFIER, Token::IDENTIFIER, Token::EOS}},
+      {"a /* unterminated *", {Token::IDENTIFIER, Token::ILLEGAL, Token::EOS}},
+  };
+
+  for (const auto& test_case : test_cases) {
+    auto scanner = make_scanner(test_case.src);
+    for (size_t i = 0; test_case.tokens[i] != Token::EOS; i++) {
+      CHECK_TOK(test_case.tokens[i], scanner->Next());
+    }
+    CHECK_TOK(Token::EOS, scanner->Next());
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -8645,6 +8645,48 @@ THREADED_TEST(Utf16Trailing3Byte) {
 }
 
 
+THREADED_TEST(Utf8WriteMixedOneByte) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  // A one-byte string with ASCII runs of varying length between Latin-1
+  // characters that need two UTF-8 bytes each.
+  const int length = 1000;
+  uint8_t chars[length];
+  std::string expected;
+  for (int i = 0; i < length; i++) {
+    chars[i] = (i % 37 == 0 || i % 11 == 5) ? 0xE9 : 'a' + i % 26;
+    if (chars[i] < 0x80) {
+      expected += static_cast<char>(chars[i]);
+    } else {
+      expected += static_cast<char>(0xC3);
+      expected += static_cast<char>(0xA9);
+    }
+  }
+  v8::Local<v8::String> str =
+      v8::String::NewFromOneByte(isolate, chars, v8::NewStringType::kNormal,
+                                 length)
+          .ToLocalChecked();
+  CHECK_EQ(static_cast<int>(expected.length()), str->Utf8Length());
+
+  std::vector<char> buffer(expected.length() + 1);
+  int nchars = 0;
+  int written = str->WriteUtf8(buffer.data(), -1, &nchars);
+  CHECK_EQ(static_cast<int>(expected.length()) + 1, written);
+  CHECK_EQ(length, nchars);
+  CHECK_EQ(0, strcmp(expected.c_str(), buffer.data()));
+
+  // With an exact capacity the writer has to switch to its slow loop.
+  std::fill(buffer.begin(), buffer.end(), 0);
+  written = str->WriteUtf8(buffer.data(), static_cast<int>(expected.length()),
+                           &nchars, v8::String::NO_NULL_TERMINATION);
+  CHECK_EQ(static_cast<int>(expected.length()), written);
+  CHECK_EQ(length, nchars);
+  CHECK_EQ(0, memcmp(expected.data(), buffer.data(), expected.length()));
+}
+
+
 THREADED_TEST(ToArrayIndex) {
   LocalContext context;
   v8::Isolate* isolate = context->GetIsolate();
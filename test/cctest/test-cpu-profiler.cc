@@ -81,6 +81,26 @@ TEST(StartStop) {
   processor->StopSynchronously();
 }
 
+TEST(DroppedSamplesWhenTickBufferIsFull) {
+  i::Isolate* isolate = CcTest::i_isolate();
+  CpuProfilesCollection profiles(isolate);
+  ProfileGenerator generator(&profiles);
+  std::unique_ptr<ProfilerEventsProcessor> processor(
+      new ProfilerEventsProcessor(isolate, &generator,
+                                  v8::base::TimeDelta::FromMicroseconds(100)));
+  // Without a running processor nothing drains the tick sample buffer.
+  unsigned enqueued = 0;
+  while (v8::TickSample* sample = processor->StartTickSample()) {
+    sample->frames_count = 0;
+    processor->FinishTickSample();
+    enqueued++;
+  }
+  CHECK_LT(0u, enqueued);
+  CHECK_EQ(1u, processor->dropped_samples());
+  CHECK_NULL(processor->StartTickSample());
+  CHECK_EQ(2u, processor->dropped_samples());
+}
+
 static void EnqueueTickSampleEvent(ProfilerEventsProcessor* proc,
                                    i::Address frame1,
                                    i::Address frame2 = nullptr,
@@ -484,5 +484,44 @@ TEST(GCFromWeakCallbacks) {
   }
 }
 
+TEST(ScavengeManyNewSpaceGlobalHandles) {
+  // Enough handles to be split across several parallel scavenging items.
+  FLAG_parallel_scavenge_global_handles = true;
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+
+  static const int kNumberOfHandles = 2500;
+  std::vector<v8::Global<v8::Object>> handles(kNumberOfHandles);
+  std::vector<Address> addresses(kNumberOfHandles);
+  for (int i = 0; i < kNumberOfHandles; i++) {
+    v8::HandleScope inner_scope(isolate);
+    v8::Local<v8::Object> object = v8::Object::New(isolate);
+    CHECK(object->Set(context, v8_str("index"), v8_num(i)).FromJust());
+    Handle<JSReceiver> o = v8::Utils::OpenHandle(*object);
+    CHECK(CcTest::heap()->InNewSpace(*o));
+    addresses[i] = o->address();
+    handles[i].Reset(isolate, object);
+  }
+
+  CcTest::CollectGarbage(NEW_SPACE);
+
+  for (int i = 0; i < kNumberOfHandles; i++) {
+    v8::HandleScope inner_scope(isolate);
+    CHECK(!handles[i].IsEmpty());
+    v8::Local<v8::Object> object =
+        v8::Local<v8::Object>::New(isolate, handles[i]);
+    Handle<JSReceiver> o = v8::Utils::OpenHandle(*object);
+    // The handle must point at the evacuated copy of its target.
+    CHECK(!CcTest::heap()->InFromSpace(*o));
+    CHECK_NE(addresses[i], o->address());
+    CHECK_EQ(i, object->Get(context, v8_str("index"))
+                    .ToLocalChecked()
+                    ->Int32Value(context)
+                    .FromJust());
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
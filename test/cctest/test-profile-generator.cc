@@ -316,6 +316,25 @@ TEST(CodeMapMoveAndDeleteCode) {
 }
 
 
+TEST(CodeMapRepeatedLookups) {
+  CodeMap code_map;
+  CodeEntry entry1(i::CodeEventListener::FUNCTION_TAG, "aaa");
+  CodeEntry entry2(i::CodeEventListener::FUNCTION_TAG, "bbb");
+  code_map.AddCode(ToAddress(0x1500), &entry1, 0x200);
+  CHECK_EQ(&entry1, code_map.FindEntry(ToAddress(0x1600)));
+  CHECK_EQ(&entry1, code_map.FindEntry(ToAddress(0x1500)));
+  CHECK(!code_map.FindEntry(ToAddress(0x1700)));
+  // Replacing the code object that was found last must not return the stale
+  // entry.
+  code_map.AddCode(ToAddress(0x1600), &entry2, 0x100);
+  CHECK_EQ(&entry2, code_map.FindEntry(ToAddress(0x1600)));
+  CHECK(!code_map.FindEntry(ToAddress(0x1500)));
+  code_map.MoveCode(ToAddress(0x1600), ToAddress(0x2000));
+  CHECK(!code_map.FindEntry(ToAddress(0x1600)));
+  CHECK_EQ(&entry2, code_map.FindEntry(ToAddress(0x2000)));
+}
+
+
 namespace {
 
 class TestSetup {
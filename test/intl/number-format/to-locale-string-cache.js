@@ -0,0 +1,20 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// toLocaleString with a single locale string reuses a cached formatter. Make
+// sure switching locales and passing options still produce fresh results.
+
+assertEquals("1,234.5", (1234.5).toLocaleString("en-US"));
+assertEquals("1.234,5", (1234.5).toLocaleString("de"));
+assertEquals("1,234.5", (1234.5).toLocaleString("en-US"));
+assertEquals("1,234.50",
+             (1234.5).toLocaleString("en-US", {minimumFractionDigits: 2}));
+assertEquals("1,234.5", (1234.5).toLocaleString("en-US"));
+assertEquals("1.234,5", (1234.5).toLocaleString(["de"]));
+
+assertThrows(() => (1).toLocaleString("en-US-u-"), RangeError);
+assertEquals("1,234.5", (1234.5).toLocaleString("en-US"));
+
+assertEquals(-1, "a".localeCompare("b", "en"));
+assertEquals(-1, "ä".localeCompare("b", "de"));
@@ -0,0 +1,81 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Cold compilation of a synthetic bundle that looks roughly like the output
+// of a module bundler: a large number of small module factory functions,
+// most of which are never called. Run with --no-compilation-cache so that
+// every iteration parses and compiles the whole bundle again.
+
+new BenchmarkSuite('BundleCompile', [1000], [
+  new Benchmark('BundleCompile', false, true, 20, CompileBundle, BundleSetup)
+]);
+
+new BenchmarkSuite('BundleCompileAndRun', [1000], [
+  new Benchmark('BundleCompileAndRun', false, true, 20, CompileAndRunBundle,
+                BundleSetup)
+]);
+
+const kModuleCount = 500;
+
+let bundle;
+
+function ModuleSource(i) {
+  return `
+  function(module, exports, require) {
+    'use strict';
+    const dependency = ${i > 0 ? `require(${i - 1})` : 'null'};
+    class Component${i} {
+      constructor(props) {
+        this.props = props;
+        this.state = { count: ${i}, items: [] };
+      }
+      update(delta) {
+        const next = Object.assign({}, this.state);
+        next.count += delta;
+        next.items = next.items.concat([delta]);
+        return next;
+      }
+      render() {
+        return 'component-${i}:' + this.state.count;
+      }
+    }
+    function helper${i}(list) {
+      return list.filter(x => x % ${i + 2} === 0).map(x => x * 2);
+    }
+    exports.Component = Component${i};
+    exports.helper = helper${i};
+    exports.dependency = dependency;
+  }`;
+}
+
+function BundleSetup() {
+  const modules = [];
+  for (let i = 0; i < kModuleCount; i++) modules.push(ModuleSource(i));
+  bundle = `(function() {
+    const factories = [${modules.join(',')}];
+    const cache = [];
+    function require(id) {
+      if (cache[id] !== undefined) return cache[id].exports;
+      const module = { exports: {} };
+      cache[id] = module;
+      factories[id](module, module.exports, require);
+      return module.exports;
+    }
+    return require;
+  })()`;
+  %FlattenString(bundle);
+}
+
+function CompileBundle() {
+  const require = eval(bundle);
+  RecordHeapUsage();
+  if (typeof require !== 'function') throw new Error('Bad bundle');
+}
+
+function CompileAndRunBundle() {
+  const require = eval(bundle);
+  const main = require(kModuleCount - 1);
+  RecordHeapUsage();
+  if (typeof main.Component !== 'function') throw new Error('Bad bundle');
+}
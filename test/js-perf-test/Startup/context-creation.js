@@ -0,0 +1,29 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('ContextCreation', [1000], [
+  new Benchmark('ContextCreation', false, true, 50, CreateContext)
+]);
+
+new BenchmarkSuite('ContextCreationAndEval', [1000], [
+  new Benchmark('ContextCreationAndEval', false, true, 50,
+                CreateContextAndEval)
+]);
+
+// Creates a fresh context from the snapshot and throws it away again.
+function CreateContext() {
+  const realm = Realm.create();
+  RecordHeapUsage();
+  Realm.dispose(realm);
+}
+
+// Creates a fresh context and runs a small script in it, so that the lazy
+// initialization of the context is included in the measurement.
+function CreateContextAndEval() {
+  const realm = Realm.create();
+  const result = Realm.eval(realm, '[1, 2, 3].map(x => x * 2).join()');
+  RecordHeapUsage();
+  Realm.dispose(realm);
+  if (result !== '2,4,6') throw new Error('Unexpected result ' + result);
+}
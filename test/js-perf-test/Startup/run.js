@@ -0,0 +1,37 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+
+load('../base.js');
+
+load('context-creation.js');
+load('bundle-compile.js');
+
+var success = true;
+var peakHeapUsage = 0;
+
+// Called by the benchmarks while their data is still alive, so that the
+// reported peak includes the contexts and bundles they create.
+function RecordHeapUsage() {
+  peakHeapUsage = Math.max(peakHeapUsage, %GetHeapUsage());
+}
+
+function PrintResult(name, result) {
+  print(name + '-Startup(Score): ' + result);
+}
+
+
+function PrintError(name, error) {
+  PrintResult(name, error);
+  success = false;
+}
+
+
+BenchmarkSuite.config.doWarmup = undefined;
+BenchmarkSuite.config.doDeterministic = undefined;
+
+BenchmarkSuite.RunSuites({ NotifyResult: PrintResult,
+                           NotifyError: PrintError });
+
+if (success) PrintResult('PeakHeapUsage', peakHeapUsage);
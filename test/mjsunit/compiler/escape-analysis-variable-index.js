@@ -0,0 +1,46 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-escape --turbo-escape-variable-index
+
+function pick(a, b, i) {
+  var pair = [a, b];
+  return pair[i & 1];
+}
+
+assertEquals(1, pick(1, 2, 0));
+assertEquals(2, pick(1, 2, 1));
+%OptimizeFunctionOnNextCall(pick);
+assertEquals(3, pick(3, 4, 0));
+assertEquals(4, pick(3, 4, 1));
+assertEquals("x", pick("x", {}, 2));
+
+function sum(a, b, c) {
+  var triple = [a, b, c];
+  var result = 0;
+  for (var i = 0; i < 3; ++i) result += triple[i];
+  return result;
+}
+
+assertEquals(6, sum(1, 2, 3));
+assertEquals(6, sum(1, 2, 3));
+%OptimizeFunctionOnNextCall(sum);
+assertEquals(15, sum(4, 5, 6));
+
+// The array is created and written inside the loop before the load, so its
+// fields are not yet defined at the loop header during the analysis.
+function loop(a, b, n) {
+  var result = 0;
+  for (var i = 0; i < n; ++i) {
+    var pair = [a, b];
+    pair[i & 1] = i;
+    result += pair[(i + 1) & 1];
+  }
+  return result;
+}
+
+assertEquals(6, loop(1, 2, 4));
+assertEquals(6, loop(1, 2, 4));
+%OptimizeFunctionOnNextCall(loop);
+assertEquals(21, loop(3, 4, 6));
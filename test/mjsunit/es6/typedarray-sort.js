@@ -68,3 +68,46 @@ for (var constructor of typedArrayConstructors) {
   %ArrayBufferNeuter(array.buffer);
   assertThrows(() => array.sort(), TypeError);
 }
+
+// Large integer arrays are sorted with counting and radix sorts.
+(function TestLargeIntegerArraySort() {
+  var kLength = 5000;
+  var integerConstructors = [
+    Uint8Array, Int8Array, Uint16Array, Int16Array, Uint32Array, Int32Array,
+    Uint8ClampedArray
+  ];
+  for (var constructor of integerConstructors) {
+    var a = new constructor(kLength);
+    var seed = 1;
+    for (var i = 0; i < kLength; i++) {
+      seed = (seed * 1103515245 + 12345) | 0;
+      a[i] = seed;
+    }
+    var expected = Array.from(a).sort((x, y) => x - y);
+    a.sort();
+    assertArrayLikeEquals(a, expected, constructor);
+
+    // Values sharing their low bytes still sort by the high bytes.
+    if (constructor.BYTES_PER_ELEMENT > 1) {
+      for (var i = 0; i < kLength; i++) a[i] = (kLength - i) << 8;
+      expected = Array.from(a).sort((x, y) => x - y);
+      a.sort();
+      assertArrayLikeEquals(a, expected, constructor);
+    }
+  }
+})();
+
+// Large arrays backed by a SharedArrayBuffer are sorted through a copy.
+(function TestLargeSharedArraySort() {
+  var kLength = 5000;
+  var a = new Uint32Array(
+      new SharedArrayBuffer(kLength * Uint32Array.BYTES_PER_ELEMENT));
+  var seed = 1;
+  for (var i = 0; i < kLength; i++) {
+    seed = (seed * 1103515245 + 12345) | 0;
+    a[i] = seed;
+  }
+  var expected = Array.from(a).sort((x, y) => x - y);
+  a.sort();
+  assertArrayLikeEquals(a, expected, Uint32Array);
+})();
@@ -0,0 +1,31 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-gc --noincremental-marking
+
+// Build a chain of ephemerons in reverse order, so that each step of the
+// marking fixpoint only makes the next key reachable. Values also point to
+// weak maps that are only discovered during the fixpoint.
+var kLength = 100;
+var map = new WeakMap;
+var root = {};
+var keys = [root];
+for (var i = 1; i < kLength; i++) keys.push({});
+for (var i = kLength - 1; i > 0; i--) {
+  var inner = new WeakMap;
+  inner.set(keys[i], {next: keys[i]});
+  map.set(keys[i - 1], {next: keys[i], inner: inner});
+}
+keys = null;
+
+gc();
+
+var key = root;
+for (var i = 1; i < kLength; i++) {
+  var value = map.get(key);
+  assertNotSame(undefined, value);
+  assertSame(value.next, value.inner.get(value.next).next);
+  key = value.next;
+}
+assertSame(undefined, map.get(key));
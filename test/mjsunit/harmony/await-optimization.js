@@ -0,0 +1,80 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --harmony-await-optimization
+
+(function TestAwaitNativePromiseTakesOneTick() {
+  var log = [];
+  (async function() {
+    await Promise.resolve();
+    log.push("await");
+  })();
+  Promise.resolve()
+      .then(() => log.push(1))
+      .then(() => log.push(2))
+      .then(() => log.push(3));
+  %RunMicrotasks();
+  assertEquals(["await", 1, 2, 3], log);
+})();
+
+(function TestAwaitPendingPromise() {
+  var log = [];
+  var resolve;
+  var promise = new Promise(r => resolve = r);
+  (async function() {
+    log.push(await promise);
+  })();
+  %RunMicrotasks();
+  assertEquals([], log);
+  resolve(42);
+  %RunMicrotasks();
+  assertEquals([42], log);
+})();
+
+(function TestAwaitRejectedPromise() {
+  var log = [];
+  (async function() {
+    try {
+      await Promise.reject(new Error("boom"));
+    } catch (e) {
+      log.push(e.message);
+    }
+  })();
+  %RunMicrotasks();
+  assertEquals(["boom"], log);
+})();
+
+(function TestAwaitAsyncGenerator() {
+  var log = [];
+  async function* gen() {
+    log.push(await Promise.resolve(1));
+    yield 2;
+  }
+  gen().next().then(result => log.push(result.value));
+  %RunMicrotasks();
+  assertEquals([1, 2], log);
+})();
+
+(function TestAwaitPromiseWithModifiedConstructor() {
+  // A promise whose "constructor" is not %Promise% is still wrapped.
+  var log = [];
+  var promise = Promise.resolve("wrapped");
+  promise.constructor = function() {};
+  (async function() {
+    log.push(await promise);
+  })();
+  %RunMicrotasks();
+  assertEquals(["wrapped"], log);
+})();
+
+(function TestAwaitThenable() {
+  var log = [];
+  var thenable = { then(resolve) { resolve("thenable"); } };
+  (async function() {
+    log.push(await thenable);
+    log.push(await 7);
+  })();
+  %RunMicrotasks();
+  assertEquals(["thenable", 7], log);
+})();
@@ -0,0 +1,40 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --harmony-bigint
+
+// Operands of thousands of bits go through Karatsuba multiplication.
+
+(function TestMersenneProducts() {
+  // (2^n - 1) * (2^m - 1) == 2^(n+m) - 2^n - 2^m + 1
+  var sizes = [1000, 2176, 2200, 4000, 8191, 20000, 65536];
+  for (var n of sizes) {
+    for (var m of sizes) {
+      var a = (1n << BigInt(n)) - 1n;
+      var b = (1n << BigInt(m)) - 1n;
+      var expected = (1n << BigInt(n + m)) - (1n << BigInt(n)) -
+                     (1n << BigInt(m)) + 1n;
+      assertEquals(expected, a * b);
+      assertEquals(expected, b * a);
+      assertEquals(-expected, -a * b);
+      assertEquals(expected, -a * -b);
+    }
+  }
+})();
+
+(function TestAgainstDivision() {
+  var x = 0x123456789abcdef0fedcba9876543210n;
+  var a = 1n;
+  var b = 1n;
+  for (var i = 0; i < 120; i++) {
+    a = a * x + BigInt(i);
+    if (i % 3 == 0) b = b * x - BigInt(i);
+  }
+  var product = a * b;
+  assertEquals(b * a, product);
+  assertEquals(a, product / b);
+  assertEquals(b, product / a);
+  assertEquals(0n, product % a);
+  assertEquals(a * (b + 1n), product + a);
+})();
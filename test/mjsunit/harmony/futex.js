@@ -109,6 +109,15 @@
   Atomics.wake(i32a, 0, Number.POSITIVE_INFINITY);
 })();
 
+(function TestWakeWithoutWaiters() {
+  var i32a = new Int32Array(new SharedArrayBuffer(16));
+  assertEquals(0, Atomics.wake(i32a, 0, 1));
+  assertEquals("timed-out", Atomics.wait(i32a, 0, 0, 0));
+  assertEquals("not-equal", Atomics.wait(i32a, 0, 1, 0));
+  assertEquals(0, Atomics.wake(i32a, 0, Number.POSITIVE_INFINITY));
+  assertEquals(0, %AtomicsNumWaitersForTesting(i32a, 0));
+})();
+
 // In a previous version, this test caused a check failure
 (function TestObjectWaitValue() {
   var sab = new SharedArrayBuffer(16);
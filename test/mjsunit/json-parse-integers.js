@@ -0,0 +1,23 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Integers around the Smi range and the limit of exactly representable
+// doubles must parse to the same values as Number().
+var inputs = [
+  "0", "-0", "7", "-7", "999999999", "1000000000", "1073741823",
+  "1073741824", "2147483647", "2147483648", "-2147483649",
+  "1523456789012", "-1523456789012", "999999999999999", "1000000000000000",
+  "9007199254740991", "9007199254740993", "123456789012345678901234567890"
+];
+
+for (var input of inputs) {
+  assertEquals(Number(input), JSON.parse(input), input);
+  assertEquals(Number(input), JSON.parse("[" + input + "]")[0], input);
+  assertEquals(Number(input), JSON.parse("{\"a\": " + input + " }").a, input);
+}
+
+assertEquals(-0, JSON.parse("-0"));
+assertEquals(1e15, JSON.parse("1000000000000000"));
+assertEquals(1.5e14, JSON.parse("150000000000000.0"));
+assertThrows(() => JSON.parse("01"), SyntaxError);
@@ -20,3 +20,73 @@ f("make it generic", 0, 0);
   f(Array.prototype, "constructor", MyArray);
   assertFalse(%SpeciesProtector());
 })();
+
+(function TestTypedArrayStores() {
+  var constructors = [Uint8Array, Uint8ClampedArray, Int8Array, Uint16Array,
+                      Int16Array, Uint32Array, Int32Array, Float32Array,
+                      Float64Array];
+  var values = [0, 1, -1, 255, 256, -129, 1.5, -0.5, 2**31, NaN, Infinity];
+  for (var C of constructors) {
+    for (var v of values) {
+      var a = new C(4);
+      f(a, 2, v);
+      assertEquals(new C([v])[0], a[2]);
+      // Out-of-bounds stores are ignored.
+      f(a, 4, v);
+      assertEquals(4, a.length);
+      assertEquals(undefined, a[4]);
+    }
+    // Values that need ToNumber still call valueOf.
+    var a = new C(2);
+    f(a, 1, {valueOf() { return 7; }});
+    assertEquals(7, a[1]);
+    // Stores to detached buffers are ignored.
+    %ArrayBufferNeuter(a.buffer);
+    f(a, 0, 1);
+    assertEquals(undefined, a[0]);
+  }
+  var b = new BigInt64Array(1);
+  f(b, 0, 5n);
+  assertEquals(5n, b[0]);
+})();
+
+(function TestArrayGrowth() {
+  var smis = [];
+  for (var i = 0; i < 100; i++) f(smis, i, i);
+  assertEquals(100, smis.length);
+  for (var i = 0; i < 100; i++) assertEquals(i, smis[i]);
+
+  var doubles = [0.5];
+  for (var i = 1; i < 100; i++) f(doubles, i, i + 0.5);
+  assertEquals(100, doubles.length);
+  for (var i = 0; i < 100; i++) assertEquals(i + 0.5, doubles[i]);
+
+  var objects = [{}];
+  for (var i = 1; i < 100; i++) f(objects, i, {i});
+  assertEquals(100, objects.length);
+  for (var i = 1; i < 100; i++) assertEquals(i, objects[i].i);
+
+  // Stores that leave a gap still work.
+  var gap = [1, 2, 3];
+  f(gap, 10, 4);
+  assertEquals(11, gap.length);
+  assertEquals(4, gap[10]);
+  assertFalse(5 in gap);
+
+  // A non-writable length prevents appending.
+  var fixed = [1, 2, 3];
+  Object.defineProperty(fixed, 'length', {writable: false});
+  f(fixed, 3, 4);
+  assertEquals(3, fixed.length);
+  assertEquals(undefined, fixed[3]);
+
+  // Setters on the prototype chain are still called.
+  var log = [];
+  var proto = [];
+  Object.defineProperty(proto, 3, {set(v) { log.push(v); }});
+  var child = [0, 1, 2];
+  Object.setPrototypeOf(child, proto);
+  f(child, 3, 'x');
+  assertEquals(['x'], log);
+  assertEquals(3, child.length);
+})();
@@ -0,0 +1,64 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Dense switches over Smi labels are dispatched through a jump table; tags
+// that are not Smis must still be compared with '==='.
+
+function dense(x) {
+  switch (x) {
+    case 0: return "zero";
+    case 1: return "one";
+    case 2: return "two";
+    case 4: return "four";
+    case 4: return "duplicate";
+    case 5: return "five";
+  }
+  return "none";
+}
+
+function withDefault(x) {
+  var result = "";
+  switch (x) {
+    case 10: result += "a";
+    case 11: result += "b"; break;
+    default: result += "d";
+    case 13: result += "c"; break;
+    case 14: result += "e"; break;
+  }
+  return result;
+}
+
+function test() {
+  assertEquals("zero", dense(0));
+  assertEquals("one", dense(1));
+  assertEquals("two", dense(2));
+  assertEquals("none", dense(3));
+  assertEquals("four", dense(4));
+  assertEquals("five", dense(5));
+  assertEquals("none", dense(6));
+  assertEquals("none", dense(-1));
+  assertEquals("one", dense(0.5 + 0.5));
+  assertEquals("two", dense(Math.sqrt(4)));
+  assertEquals("none", dense(-0.5));
+  assertEquals("none", dense("1"));
+  assertEquals("none", dense(undefined));
+  assertEquals("none", dense({}));
+
+  assertEquals("ab", withDefault(10));
+  assertEquals("b", withDefault(11));
+  assertEquals("dc", withDefault(12));
+  assertEquals("c", withDefault(13));
+  assertEquals("e", withDefault(14));
+  assertEquals("dc", withDefault(15));
+  assertEquals("dc", withDefault("10"));
+  assertEquals("ab", withDefault(20 / 2));
+}
+
+test();
+test();
+%OptimizeFunctionOnNextCall(dense);
+%OptimizeFunctionOnNextCall(withDefault);
+test();
@@ -0,0 +1,39 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-wasm --no-wasm-trap-handler
+
+load("test/mjsunit/wasm/wasm-constants.js");
+load("test/mjsunit/wasm/wasm-module-builder.js");
+
+(function TestGrowMemoryPreservesContents() {
+  print(arguments.callee.name);
+  var kMaxPages = 16;
+  var memory = new WebAssembly.Memory({initial: 1, maximum: kMaxPages});
+  var builder = new WasmModuleBuilder();
+  builder.addImportedMemory("m", "memory", 1, kMaxPages);
+  builder.addFunction("load", kSig_i_i)
+      .addBody([kExprGetLocal, 0, kExprI32LoadMem, 0, 0])
+      .exportFunc();
+  var instance = builder.instantiate({m: {memory: memory}});
+
+  new Uint32Array(memory.buffer)[0] = 0x1234;
+  for (var pages = 1; pages < kMaxPages; pages++) {
+    var old_buffer = memory.buffer;
+    var last = pages * kPageSize - 4;
+    new Uint32Array(old_buffer)[last / 4] = pages;
+    assertTraps(kTrapMemOutOfBounds, () => instance.exports.load(last + 4));
+
+    assertEquals(pages, memory.grow(1));
+    assertEquals(0, old_buffer.byteLength);
+    assertEquals((pages + 1) * kPageSize, memory.buffer.byteLength);
+
+    var view = new Uint32Array(memory.buffer);
+    assertEquals(0x1234, view[0]);
+    assertEquals(pages, view[last / 4]);
+    assertEquals(0, view[view.length - 1]);
+    assertEquals(pages, instance.exports.load(last));
+    assertEquals(0, instance.exports.load(last + 4));
+  }
+})();
@@ -91,5 +91,38 @@ TEST_F(OptimizingCompileDispatcherTest, NonBlockingFlush) {
   dispatcher.Stop();
 }
 
+TEST_F(OptimizingCompileDispatcherTest, HotJobReplacesColdJob) {
+  int old_queue_length = FLAG_concurrent_recompilation_queue_length;
+  FLAG_concurrent_recompilation_queue_length = 1;
+  FLAG_concurrent_recompilation_priority = true;
+  FLAG_block_concurrent_recompilation = true;
+  Handle<JSFunction> cold = RunJS<JSFunction>("function c() {}; c(); c;");
+  Handle<JSFunction> hot = RunJS<JSFunction>("function h() {}; h(); h;");
+  hot->feedback_vector()->set_profiler_ticks(10);
+
+  OptimizingCompileDispatcher dispatcher(i_isolate());
+  BlockingCompilationJob* cold_job =
+      new BlockingCompilationJob(i_isolate(), cold);
+  ASSERT_TRUE(dispatcher.MakeRoomFor(cold_job));
+  dispatcher.QueueForOptimization(cold_job);
+  ASSERT_FALSE(dispatcher.IsQueueAvailable());
+
+  BlockingCompilationJob* hot_job =
+      new BlockingCompilationJob(i_isolate(), hot);
+  ASSERT_TRUE(dispatcher.MakeRoomFor(hot_job));
+  dispatcher.QueueForOptimization(hot_job);
+
+  // The queued hot job is not replaced by a colder one.
+  std::unique_ptr<BlockingCompilationJob> other_cold_job(
+      new BlockingCompilationJob(i_isolate(), cold));
+  ASSERT_FALSE(dispatcher.MakeRoomFor(other_cold_job.get()));
+
+  dispatcher.Flush(BlockingBehavior::kDontBlock);
+  dispatcher.Stop();
+  FLAG_block_concurrent_recompilation = false;
+  FLAG_concurrent_recompilation_priority = false;
+  FLAG_concurrent_recompilation_queue_length = old_queue_length;
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -4,6 +4,7 @@
 
 #include "test/unittests/compiler/instruction-selector-unittest.h"
 
+#include "src/compiler/instruction-scheduler.h"
 #include "src/compiler/node-matchers.h"
 #include "src/objects-inl.h"
 
@@ -1631,6 +1632,43 @@ TEST_F(InstructionSelectorTest, SpeculationFence) {
   EXPECT_EQ(kLFence, s[0]->arch_opcode());
 }
 
+// -----------------------------------------------------------------------------
+// Instruction scheduling.
+
+class InstructionSchedulerTester {
+ public:
+  static int GetInstructionLatency(const Instruction* instr) {
+    return InstructionScheduler::GetInstructionLatency(instr);
+  }
+};
+
+TEST_F(InstructionSelectorTest, MovlLatency) {
+  int register_latency;
+  {
+    StreamBuilder m(this, MachineType::Int32(), MachineType::Int64());
+    m.Return(m.TruncateInt64ToInt32(m.Parameter(0)));
+    Stream s = m.Build();
+    ASSERT_EQ(1U, s.size());
+    EXPECT_EQ(kX64Movl, s[0]->arch_opcode());
+    EXPECT_EQ(kMode_None, s[0]->addressing_mode());
+    register_latency = InstructionSchedulerTester::GetInstructionLatency(s[0]);
+  }
+  int memory_latency;
+  {
+    StreamBuilder m(this, MachineType::Int32(), MachineType::Pointer());
+    m.Return(m.Load(MachineType::Int32(), m.Parameter(0)));
+    Stream s = m.Build();
+    ASSERT_EQ(1U, s.size());
+    EXPECT_EQ(kX64Movl, s[0]->arch_opcode());
+    EXPECT_NE(kMode_None, s[0]->addressing_mode());
+    memory_latency = InstructionSchedulerTester::GetInstructionLatency(s[0]);
+  }
+  // Register moves are not treated as loads, even though their input is not
+  // allocated to a register yet.
+  EXPECT_EQ(1, register_latency);
+  EXPECT_LT(register_latency, memory_latency);
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -415,5 +415,48 @@ TEST_F(GCTracerTest, MultithreadedBackgroundScope) {
   EXPECT_LE(0, tracer->current_.scopes[GCTracer::Scope::MC_BACKGROUND_MARKING]);
 }
 
+TEST_F(GCTracerTest, RecordedSummaries) {
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+  EXPECT_EQ(0, tracer->RecordedSummaryCount());
+
+  tracer->Start(SCAVENGER, GarbageCollectionReason::kTesting,
+                "collector unittest");
+  tracer->AddScopeSample(GCTracer::Scope::SCAVENGER_SCAVENGE, 10);
+  tracer->AddBackgroundScopeSample(
+      GCTracer::BackgroundScope::SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL, 20,
+      nullptr);
+  tracer->Stop(SCAVENGER);
+  tracer->Start(MARK_COMPACTOR, GarbageCollectionReason::kTesting,
+                "collector unittest");
+  tracer->AddScopeSample(GCTracer::Scope::MC_MARK, 30);
+  tracer->AddScopeSample(GCTracer::Scope::MC_SWEEP, 40);
+  tracer->Stop(MARK_COMPACTOR);
+
+  EXPECT_EQ(2, tracer->RecordedSummaryCount());
+  const GCTracer::Summary& last = tracer->RecordedSummary(0);
+  EXPECT_EQ(GCTracer::Event::MARK_COMPACTOR, last.type);
+  EXPECT_DOUBLE_EQ(30, last.mark_duration);
+  EXPECT_DOUBLE_EQ(40, last.sweep_duration);
+  EXPECT_DOUBLE_EQ(0, last.background_duration);
+  const GCTracer::Summary& first = tracer->RecordedSummary(1);
+  EXPECT_EQ(GCTracer::Event::SCAVENGER, first.type);
+  EXPECT_DOUBLE_EQ(10, first.evacuate_duration);
+  EXPECT_DOUBLE_EQ(20, first.background_duration);
+  EXPECT_LE(first.start_time, last.start_time);
+
+  // Only the most recent collections are kept.
+  for (int i = 0; i < base::RingBuffer<GCTracer::Summary>::kSize; i++) {
+    tracer->Start(SCAVENGER, GarbageCollectionReason::kTesting,
+                  "collector unittest");
+    tracer->Stop(SCAVENGER);
+  }
+  EXPECT_EQ(base::RingBuffer<GCTracer::Summary>::kSize,
+            tracer->RecordedSummaryCount());
+  for (int i = 0; i < tracer->RecordedSummaryCount(); i++) {
+    EXPECT_EQ(GCTracer::Event::SCAVENGER, tracer->RecordedSummary(i).type);
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
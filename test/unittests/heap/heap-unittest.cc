@@ -89,6 +89,25 @@ TEST(Heap, OldGenerationSize) {
   }
 }
 
+TEST(Heap, NewSpaceCapacityForOverheadTarget) {
+  const size_t MB = static_cast<size_t>(i::MB);
+  // Unknown speeds keep the current capacity.
+  EXPECT_EQ(1 * MB,
+            i::Heap::NewSpaceCapacityForOverheadTarget(MB, 0, 1000, 0.05, MB));
+  EXPECT_EQ(1 * MB,
+            i::Heap::NewSpaceCapacityForOverheadTarget(MB, 1000, 0, 0.05, MB));
+  // 1MB surviving at 1MB/ms takes 1ms. At 1MB/ms allocation throughput a 5%
+  // overhead requires a scavenge every 20ms, i.e. a 20MB semi-space.
+  EXPECT_EQ(20 * MB, i::Heap::NewSpaceCapacityForOverheadTarget(
+                         MB, MB, MB, 0.05, 8 * MB));
+  // Halving the allocation throughput halves the capacity.
+  EXPECT_EQ(10 * MB, i::Heap::NewSpaceCapacityForOverheadTarget(
+                         MB, MB, MB / 2, 0.05, 8 * MB));
+  // Nothing surviving does not require any capacity.
+  EXPECT_EQ(0u, i::Heap::NewSpaceCapacityForOverheadTarget(0, MB, MB, 0.05,
+                                                           8 * MB));
+}
+
 TEST_F(HeapTest, ASLR) {
 #if V8_TARGET_ARCH_X64
 #if V8_OS_MACOSX
@@ -4,6 +4,7 @@
 
 #include <limits>
 
+#include "src/flags.h"
 #include "src/globals.h"
 #include "src/heap/scavenge-job.h"
 #include "src/utils.h"
@@ -110,5 +111,27 @@ TEST(ScavengeJob, EnoughIdleTimeForScavengeHighScavengeSpeed) {
       expected_time - 1, scavenge_speed, new_space_size));
 }
 
+
+TEST(ScavengeJob, TaskTriggerLimitEmptyNewSpace) {
+  EXPECT_FALSE(ScavengeJob::ReachedTaskTriggerLimit(0, kNewSpaceCapacity));
+}
+
+
+TEST(ScavengeJob, TaskTriggerLimitFullNewSpace) {
+  EXPECT_TRUE(ScavengeJob::ReachedTaskTriggerLimit(kNewSpaceCapacity,
+                                                   kNewSpaceCapacity));
+}
+
+
+TEST(ScavengeJob, TaskTriggerLimitRespectsFlag) {
+  int saved_trigger = FLAG_scavenge_task_trigger;
+  FLAG_scavenge_task_trigger = 50;
+  size_t half = kNewSpaceCapacity / 2;
+  EXPECT_FALSE(
+      ScavengeJob::ReachedTaskTriggerLimit(half - 1, kNewSpaceCapacity));
+  EXPECT_TRUE(ScavengeJob::ReachedTaskTriggerLimit(half, kNewSpaceCapacity));
+  FLAG_scavenge_task_trigger = saved_trigger;
+}
+
 }  // namespace internal
 }  // namespace v8
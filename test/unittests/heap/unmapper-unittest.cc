@@ -80,6 +80,44 @@ TEST_F(SequentialUnmapperTest, UnmapOnTeardown) {
   EXPECT_EQ(-1, msync(start_address, page_size, MS_SYNC));
 }
 
+TEST_F(SequentialUnmapperTest, CommittedBufferedMemoryOfLargePage) {
+  const size_t object_size = 4 * MB;
+  LargePage* page = allocator()->AllocateLargePage(
+      object_size, heap()->lo_space(), Executability::NOT_EXECUTABLE);
+  EXPECT_NE(nullptr, page);
+  const size_t page_size = page->size();
+  unmapper()->FreeQueuedChunks();
+  EXPECT_EQ(0u, unmapper()->CommittedBufferedMemory());
+  const size_t committed = heap()->CommittedMemory();
+  allocator()->Free<MemoryAllocator::kPreFreeAndQueue>(page);
+  EXPECT_EQ(page_size, unmapper()->CommittedBufferedMemory());
+  EXPECT_EQ(committed + page_size, heap()->CommittedMemory());
+  unmapper()->FreeQueuedChunks();
+  EXPECT_EQ(0u, unmapper()->CommittedBufferedMemory());
+  EXPECT_EQ(committed, heap()->CommittedMemory());
+}
+
+TEST_F(SequentialUnmapperTest, SharedPagePoolKeepsMappingOnTeardown) {
+  bool old_shared_page_pool = FLAG_shared_page_pool;
+  FLAG_shared_page_pool = true;
+  Page* page =
+      allocator()->AllocatePage(MemoryAllocator::PageAreaSize(OLD_SPACE),
+                                static_cast<PagedSpace*>(heap()->old_space()),
+                                Executability::NOT_EXECUTABLE);
+  EXPECT_NE(nullptr, page);
+  const int page_size = getpagesize();
+  void* start_address = static_cast<void*>(page->address());
+  allocator()->Free<MemoryAllocator::kPooledAndQueue>(page);
+  unmapper()->TearDown();
+  // The reservation moved to the process-wide pool instead of being unmapped.
+  EXPECT_EQ(1u, SharedPagePool::NumberOfChunks());
+  EXPECT_EQ(0, msync(start_address, page_size, MS_SYNC));
+  SharedPagePool::ReleaseAll();
+  EXPECT_EQ(0u, SharedPagePool::NumberOfChunks());
+  EXPECT_EQ(-1, msync(start_address, page_size, MS_SYNC));
+  FLAG_shared_page_pool = old_shared_page_pool;
+}
+
 #endif  // __linux__
 
 }  // namespace internal
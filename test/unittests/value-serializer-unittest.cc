@@ -1143,6 +1143,24 @@ TEST_F(ValueSerializerTest, RoundTripDenseArrayContainingUndefined) {
   ExpectScriptTrue("result[0] === undefined");
 }
 
+TEST_F(ValueSerializerTest, RoundTripDenseDoubleArray) {
+  // Packed double arrays are written in one pass.
+  Local<Value> value = RoundTripTest("[1.5, -0, NaN, Infinity, 2.25]");
+  ASSERT_TRUE(value->IsArray());
+  EXPECT_EQ(5u, Array::Cast(*value)->Length());
+  ExpectScriptTrue("result[0] === 1.5");
+  ExpectScriptTrue("Object.is(result[1], -0)");
+  ExpectScriptTrue("Number.isNaN(result[2])");
+  ExpectScriptTrue("result[3] === Infinity");
+  ExpectScriptTrue("result[4] === 2.25");
+
+  value = RoundTripTest(
+      "var x = []; for (var i = 0; i < 10000; i++) x.push(i + 0.5); x;");
+  ASSERT_TRUE(value->IsArray());
+  EXPECT_EQ(10000u, Array::Cast(*value)->Length());
+  ExpectScriptTrue("result.every((v, i) => v === i + 0.5)");
+}
+
 TEST_F(ValueSerializerTest, DecodeDenseArrayContainingUndefined) {
   // In previous versions, "undefined" in a dense array signified absence of the
   // element (for compatibility). In new versions, it has a separate encoding.